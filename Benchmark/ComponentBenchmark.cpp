@@ -0,0 +1,804 @@
+// 세 모듈(LogFileManager, CircularBuffer, ParallelProcessor)과 이를 잇는 StreamingPipeline의 성능 측정 (Google Benchmark)
+// 스레드 수와 데이터 크기를 바꿔 가며 측정하고, 마지막에 스레드 수별 속도 향상과 효율을 요약함
+// 빌드: 저장소 최상위에서 cmake -S . -B build && cmake --build build --target ComponentBenchmark
+// 실행: ./build/ComponentBenchmark [--perf_counters] [Google Benchmark 옵션, 예: --benchmark_filter=Sort]
+//   --perf_counters: 측정 구간의 IPC, 캐시 미스, 페이지 폴트 등을 카운터로 함께 출력 (Linux)
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LogFileManager.h"
+#include "CircularBuffer.h"
+#include "ParallelProcessor.h"
+#include "StreamingPipeline.h"
+#include "PerfCounters.h"
+
+namespace {
+
+// --perf_counters로 켬 (카운터를 여닫는 비용이 있으므로 기본값은 꺼짐)
+bool perf_counters_enabled = false;
+
+// 측정 구간([생성, 소멸])의 성능 카운터를 반복당 평균으로 state.counters에 추가
+class PerfScope {
+private:
+    benchmark::State& state;
+    PerfCounters counters;
+    bool running = false;
+
+public:
+    explicit PerfScope(benchmark::State& benchmark_state) : state(benchmark_state) {
+        if (perf_counters_enabled) {
+            running = counters.start();
+        }
+    }
+
+    ~PerfScope() {
+        if (!running) {
+            return;
+        }
+        PerfCounters::Sample sample = counters.stop();
+        auto per_iteration = [](uint64_t value) {
+            return benchmark::Counter(static_cast<double>(value), benchmark::Counter::kAvgIterations);
+        };
+        if (sample.has(PerfCounters::Cycles) && sample.has(PerfCounters::Instructions) && sample[PerfCounters::Cycles] > 0) {
+            state.counters["IPC"] = static_cast<double>(sample[PerfCounters::Instructions]) / static_cast<double>(sample[PerfCounters::Cycles]);
+        }
+        if (sample.has(PerfCounters::CacheMisses)) {
+            state.counters["cache_misses"] = per_iteration(sample[PerfCounters::CacheMisses]);
+            if (sample.has(PerfCounters::CacheReferences) && sample[PerfCounters::CacheReferences] > 0) {
+                state.counters["cache_miss_rate"] = static_cast<double>(sample[PerfCounters::CacheMisses]) / static_cast<double>(sample[PerfCounters::CacheReferences]);
+            }
+        }
+        if (sample.has(PerfCounters::BranchMisses)) {
+            state.counters["branch_misses"] = per_iteration(sample[PerfCounters::BranchMisses]);
+        }
+        if (sample.has(PerfCounters::PageFaults)) {
+            state.counters["page_faults"] = per_iteration(sample[PerfCounters::PageFaults]);
+        }
+        if (sample.has(PerfCounters::ContextSwitches)) {
+            state.counters["context_switches"] = per_iteration(sample[PerfCounters::ContextSwitches]);
+        }
+    }
+};
+
+// 스레드 수: 1, 2, 4, 8과 하드웨어 스레드 수
+std::vector<int64_t> make_thread_counts() {
+    std::vector<int64_t> counts = {1, 2, 4, 8};
+    int64_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    if (std::find(counts.begin(), counts.end(), hardware) == counts.end()) {
+        counts.push_back(hardware);
+        std::sort(counts.begin(), counts.end());
+    }
+    return counts;
+}
+
+const std::vector<int64_t> thread_counts = make_thread_counts();
+
+// 픽셀 수: L2에 들어가는 크기(256x256)와 DRAM 크기(1024x1024)
+const std::vector<int64_t> pixel_counts = {1 << 16, 1 << 20};
+
+// 벤치마크 실행 파일 안에서만 쓰는 임시 폴더 (시작할 때 만들고 끝날 때 지움)
+std::filesystem::path scratch_directory() {
+    static const std::filesystem::path directory = [] {
+        auto path = std::filesystem::temp_directory_path() / ("rgt_benchmark_" + std::to_string(std::random_device{}()));
+        std::filesystem::create_directories(path);
+        return path;
+    }();
+    return directory;
+}
+
+// ---------------------------------------------------------------------------
+// LogFileManager
+// ---------------------------------------------------------------------------
+
+enum class LogMode : int64_t {
+    Immediate,  // 동기 모드, 레코드마다 flush
+    Buffered,   // 동기 모드, FlushPolicy::buffered()
+    Async       // 비동기 모드 (writer 스레드), FlushPolicy::buffered()
+};
+
+const char* log_mode_name(LogMode mode) {
+    switch (mode) {
+    case LogMode::Immediate:
+        return "immediate";
+    case LogMode::Buffered:
+        return "buffered";
+    case LogMode::Async:
+        return "async";
+    }
+    return "";
+}
+
+// 반복마다 threads개의 생산자가 모두 합쳐 records_per_iteration건을 기록하고 flushAll까지 기다림
+void BM_LogWrite(benchmark::State& state) {
+    constexpr size_t records_per_iteration = 20000;
+    auto mode = static_cast<LogMode>(state.range(0));
+    size_t producers = static_cast<size_t>(state.range(1));
+
+    std::unique_ptr<LogFileManager> manager = mode == LogMode::Async ? std::make_unique<LogFileManager>(AsyncOptions{})
+                                                                     : std::make_unique<LogFileManager>();
+    std::string path = (scratch_directory() / (std::string("write_") + log_mode_name(mode) + ".log")).string();
+    LogFileManager::LogHandle handle = manager->openLogFile(path, mode == LogMode::Immediate ? FlushPolicy::immediate() : FlushPolicy::buffered());
+    if (!handle) {
+        state.SkipWithError("로그 파일을 열 수 없습니다");
+        return;
+    }
+    const std::string message = "request handled: status=200 bytes=5123 elapsed_us=842 path=/api/v1/items";
+
+    size_t written = 0;
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            std::vector<std::thread> threads;
+            for (size_t producer = 1; producer < producers; ++producer) {
+                threads.emplace_back([&manager, &handle, &message, producers] {
+                    for (size_t i = 0; i < records_per_iteration / producers; ++i) {
+                        manager->writeLog(handle, message);
+                    }
+                });
+            }
+            for (size_t i = 0; i < records_per_iteration / producers; ++i) {
+                manager->writeLog(handle, message);
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            manager->flushAll();
+            written += records_per_iteration / producers * producers;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(written));
+    state.SetBytesProcessed(static_cast<int64_t>(written * (message.size() + 23)));  // "[YYYY-MM-DD HH:MM:SS] " + 줄바꿈
+    state.SetLabel(log_mode_name(mode));
+    manager->closeLogFile(path);
+    std::filesystem::remove(path);
+}
+
+// lines줄짜리 로그 파일을 한 번 만들어 두고 재사용
+const std::string& prepared_log(size_t lines) {
+    static std::map<size_t, std::string> files;
+    auto found = files.find(lines);
+    if (found != files.end()) {
+        return found->second;
+    }
+    std::string path = (scratch_directory() / ("read_" + std::to_string(lines) + ".log")).string();
+    {
+        LogFileManager manager;
+        LogFileManager::LogHandle handle = manager.openLogFile(path, FlushPolicy::buffered());
+        for (size_t i = 0; i < lines; ++i) {
+            manager.writeRecord(handle, Severity::Info, "request {} handled: status={} elapsed_us={}", i, 200, i % 1000);
+        }
+        manager.flushAll();
+    }
+    return files.emplace(lines, path).first->second;
+}
+
+enum class LogRead : int64_t {
+    ReadAll,   // readLogs: 모든 줄을 std::string으로 복사
+    ForEach,   // forEachLog: 줄을 복사하지 않고 콜백에 전달
+    Tail,      // tailLogs(100): 파일 끝 100줄
+    Query      // query: 부분 문자열 검색
+};
+
+void BM_LogRead(benchmark::State& state) {
+    auto kind = static_cast<LogRead>(state.range(0));
+    size_t lines = static_cast<size_t>(state.range(1));
+    const std::string& path = prepared_log(lines);
+    LogFileManager manager;
+    size_t bytes = static_cast<size_t>(std::filesystem::file_size(path));
+
+    size_t visited = 0;
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            switch (kind) {
+            case LogRead::ReadAll: {
+                auto logs = manager.readLogs(path);
+                visited += logs.size();
+                benchmark::DoNotOptimize(logs.data());
+                break;
+            }
+            case LogRead::ForEach:
+                visited += manager.forEachLog(path, [](std::string_view line) {
+                    benchmark::DoNotOptimize(line.data());
+                    return true;
+                });
+                break;
+            case LogRead::Tail: {
+                auto logs = manager.tailLogs(path, 100);
+                visited += logs.size();
+                benchmark::DoNotOptimize(logs.data());
+                break;
+            }
+            case LogRead::Query: {
+                // time_point::min() / max()는 타임스탬프로 바꿀 때 넘치므로 파일을 만든 시각 앞뒤 하루로 지정
+                auto now = std::chrono::system_clock::now();
+                auto logs = manager.query(path, now - std::chrono::hours(24), now + std::chrono::hours(24), "status=200 elapsed_us=999");
+                visited += logs.size();
+                benchmark::DoNotOptimize(logs.data());
+                break;
+            }
+            }
+        }
+    }
+    static const char* const labels[] = {"readLogs", "forEachLog", "tailLogs(100)", "query"};
+    state.SetLabel(labels[static_cast<size_t>(kind)]);
+    state.SetItemsProcessed(static_cast<int64_t>(visited));
+    if (kind != LogRead::Tail) {
+        state.SetBytesProcessed(static_cast<int64_t>(bytes * state.iterations()));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// CircularBuffer
+// ---------------------------------------------------------------------------
+
+// 가득 찬 버퍼에서 push_back 한 번 + pop_front 한 번
+template <bool PowerOfTwo>
+void BM_CircularPushPop(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    CircularBuffer<double, PowerOfTwo> buffer(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        buffer.push_back(static_cast<double>(i));
+    }
+    double value = 0.0;
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            buffer.pop_front();
+            buffer.push_back(value);
+            value += 1.0;
+        }
+    }
+    benchmark::DoNotOptimize(buffer.back());
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 1024개 묶음 push_back(span) + pop_front(count)
+template <bool PowerOfTwo>
+void BM_CircularBulk(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    constexpr size_t batch = 1024;
+    CircularBuffer<double, PowerOfTwo> buffer(capacity);
+    std::vector<double> items(batch, 1.5);
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            buffer.push_back(std::span<const double>(items));
+            if (buffer.size() > capacity / 2) {
+                buffer.pop_front(std::min(batch, buffer.size()));
+            }
+        }
+    }
+    benchmark::DoNotOptimize(buffer.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch));
+}
+
+// 반복자로 합계 (range(1) == 1이면 벡터화된 sum())
+template <bool PowerOfTwo>
+void BM_CircularIterate(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    bool reduction = state.range(1) != 0;
+    CircularBuffer<double, PowerOfTwo> buffer(capacity);
+    for (size_t i = 0; i < capacity + capacity / 3; ++i) {
+        buffer.push_back(static_cast<double>(i & 0xff));
+    }
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            double total = reduction ? static_cast<double>(buffer.sum()) : std::accumulate(buffer.begin(), buffer.end(), 0.0);
+            benchmark::DoNotOptimize(total);
+        }
+    }
+    state.SetLabel(reduction ? "sum()" : "iterator");
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(capacity));
+}
+
+inline void relax() {
+    std::this_thread::yield();
+}
+
+// threads / 2개 생산자와 threads / 2개 소비자가 MpmcCircularBuffer로 요소를 전달 (threads == 2이면 SpscCircularBuffer)
+void BM_CircularTransfer(benchmark::State& state) {
+    constexpr size_t items_per_iteration = 1 << 18;
+    size_t threads = static_cast<size_t>(state.range(0));
+    size_t producers = threads / 2;
+    size_t consumers = threads - producers;
+    bool single = producers == 1 && consumers == 1;
+    SpscCircularBuffer<uint64_t> spsc(4096);
+    MpmcCircularBuffer<uint64_t> mpmc(4096);
+
+    auto push = [&](uint64_t value) {
+        while (!(single ? spsc.try_push(value) : mpmc.try_push(value))) {
+            relax();
+        }
+    };
+    auto pop = [&](uint64_t& value) {
+        return single ? spsc.try_pop(value) : mpmc.try_pop(value);
+    };
+
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            std::atomic<size_t> received{0};
+            std::vector<std::thread> workers;
+            for (size_t p = 0; p < producers; ++p) {
+                workers.emplace_back([&, p] {
+                    for (size_t i = p; i < items_per_iteration; i += producers) {
+                        push(i);
+                    }
+                });
+            }
+            for (size_t c = 1; c < consumers; ++c) {
+                workers.emplace_back([&] {
+                    uint64_t value;
+                    while (received.load(std::memory_order_relaxed) < items_per_iteration) {
+                        if (pop(value)) {
+                            received.fetch_add(1, std::memory_order_relaxed);
+                        } else {
+                            relax();
+                        }
+                    }
+                });
+            }
+            // 마지막 소비자는 측정하는 스레드
+            uint64_t value;
+            while (received.load(std::memory_order_relaxed) < items_per_iteration) {
+                if (pop(value)) {
+                    received.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    relax();
+                }
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+    }
+    state.SetLabel(single ? "SpscCircularBuffer" : "MpmcCircularBuffer");
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(items_per_iteration));
+}
+
+// ---------------------------------------------------------------------------
+// ParallelProcessor
+// ---------------------------------------------------------------------------
+
+// 스레드 수별 전용 풀 (호출한 스레드까지 정확히 threads개가 동시에 실행되도록 작업자는 threads - 1개)
+ThreadPool& pool_for(unsigned int threads) {
+    static std::map<unsigned int, std::unique_ptr<ThreadPool>> pools;
+    std::unique_ptr<ThreadPool>& pool = pools[threads];
+    if (!pool) {
+        pool = std::make_unique<ThreadPool>(threads > 1 ? threads - 1 : 1);
+    }
+    return *pool;
+}
+
+// 크기별 임의 픽셀 (한 번만 만들고 모든 벤치마크가 공유하므로 바꾸면 안 됨, 바꾸는 벤치마크는 복사해서 사용)
+std::vector<Pixel>& random_pixels(size_t count) {
+    static std::map<size_t, std::vector<Pixel>> images;
+    std::vector<Pixel>& image = images[count];
+    if (image.empty()) {
+        std::mt19937 random(42);
+        image.resize(count);
+        for (auto& pixel : image) {
+            pixel = Pixel(static_cast<int>(random() % 256), static_cast<int>(random() % 256), static_cast<int>(random() % 256));
+        }
+    }
+    return image;
+}
+
+Pixel brighten(const Pixel& p) {
+    return Pixel(std::min(p.r + 50, 255), std::min(p.g + 50, 255), std::min(p.b + 50, 255));
+}
+
+bool is_bright(const Pixel& p) {
+    return p.r + p.g + p.b > 500;
+}
+
+int brightness(const Pixel& p) {
+    return p.r + p.g + p.b;
+}
+
+// range(0): 픽셀 수, range(1): 스레드 수
+struct ProcessorArguments {
+    size_t pixels;
+    unsigned int threads;
+    ThreadPool& pool;
+};
+
+ProcessorArguments processor_arguments(const benchmark::State& state) {
+    auto threads = static_cast<unsigned int>(state.range(1));
+    return ProcessorArguments{static_cast<size_t>(state.range(0)), threads, pool_for(threads)};
+}
+
+// 입력을 바꾸지 않는 메서드: 공용 이미지를 복사 없이 span으로 사용
+template <typename Body>
+void run_processor_benchmark(benchmark::State& state, Body&& body) {
+    ProcessorArguments arguments = processor_arguments(state);
+    ParallelProcessor<Pixel> processor(std::span<Pixel>(random_pixels(arguments.pixels)), arguments.threads, arguments.pool);
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            body(processor);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(arguments.pixels));
+}
+
+// 입력을 바꾸는 메서드: 반복마다 측정하지 않는 구간에서 원본을 다시 복사
+template <typename Body>
+void run_mutating_benchmark(benchmark::State& state, Body&& body) {
+    ProcessorArguments arguments = processor_arguments(state);
+    const std::vector<Pixel>& original = random_pixels(arguments.pixels);
+    std::vector<Pixel> image = original;
+    ParallelProcessor<Pixel> processor(std::span<Pixel>(image), arguments.threads, arguments.pool);
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::copy(original.begin(), original.end(), image.begin());
+            state.ResumeTiming();
+            body(processor);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(arguments.pixels));
+}
+
+void BM_Process(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.process(brighten).data());
+    });
+}
+
+void BM_ProcessWithProgress(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        size_t reports = 0;
+        auto result = processor.process_with_progress(brighten, [&reports](const Progress&) { ++reports; });
+        benchmark::DoNotOptimize(result.data());
+        benchmark::DoNotOptimize(reports);
+    });
+}
+
+// 공용 이미지를 바꾸지 않도록 한 번 복사해 두고, 값이 255에서 포화되므로 반복마다 되돌리지 않음 (반복해도 같은 비용)
+void BM_ProcessInPlace(benchmark::State& state) {
+    ProcessorArguments arguments = processor_arguments(state);
+    std::vector<Pixel> image = random_pixels(arguments.pixels);
+    ParallelProcessor<Pixel> processor(std::span<Pixel>(image), arguments.threads, arguments.pool);
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            processor.process_in_place(brighten);
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(arguments.pixels));
+}
+
+void BM_MapInto(benchmark::State& state) {
+    std::vector<uint8_t> gray(static_cast<size_t>(state.range(0)));
+    run_processor_benchmark(state, [&gray](ParallelProcessor<Pixel>& processor) {
+        processor.map_into(std::span<uint8_t>(gray), [](const Pixel& p) { return static_cast<uint8_t>(brightness(p) / 3); });
+        benchmark::ClobberMemory();
+    });
+}
+
+void BM_Map(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.map([](const Pixel& p) { return static_cast<uint8_t>(brightness(p) / 3); }).data());
+    });
+}
+
+void BM_Filter(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.filter(is_bright).data());
+    });
+}
+
+void BM_CountIf(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.count_if(is_bright));
+    });
+}
+
+void BM_Partition(benchmark::State& state) {
+    run_mutating_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.partition(is_bright));
+    });
+}
+
+void BM_Reduce(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.reduce([](const Pixel& a, const Pixel& b) { return a + b; }, Pixel()));
+    });
+}
+
+void BM_Pipeline(benchmark::State& state) {
+    run_processor_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.pipe().map(brighten).filter(is_bright).map(brightness).reduce(std::plus<>{}, 0));
+    });
+}
+
+void BM_ParallelSort(benchmark::State& state) {
+    run_mutating_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        processor.parallel_sort();
+        benchmark::ClobberMemory();
+    });
+}
+
+void BM_ParallelSortByKey(benchmark::State& state) {
+    run_mutating_benchmark(state, [](ParallelProcessor<Pixel>& processor) {
+        processor.parallel_sort_by_key(brightness);
+        benchmark::ClobberMemory();
+    });
+}
+
+// 정사각형 이미지 (픽셀 수는 4의 거듭제곱)
+size_t square_side(size_t pixels) {
+    return static_cast<size_t>(std::lround(std::sqrt(static_cast<double>(pixels))));
+}
+
+void BM_Stencil(benchmark::State& state) {
+    size_t side = square_side(static_cast<size_t>(state.range(0)));
+    run_processor_benchmark(state, [side](ParallelProcessor<Pixel>& processor) {
+        // Sobel 가로 경계 강도
+        auto edges = processor.stencil(side, side, 1, BorderMode::Clamp, [](const Neighborhood<Pixel>& n) {
+            return std::abs(brightness(n(1, -1)) + 2 * brightness(n(1, 0)) + brightness(n(1, 1))
+                          - brightness(n(-1, -1)) - 2 * brightness(n(-1, 0)) - brightness(n(-1, 1)));
+        });
+        benchmark::DoNotOptimize(edges.data());
+    });
+}
+
+void BM_ConvolveSeparable(benchmark::State& state) {
+    size_t side = square_side(static_cast<size_t>(state.range(0)));
+    static const std::array<float, 5> gaussian = {1 / 16.f, 4 / 16.f, 6 / 16.f, 4 / 16.f, 1 / 16.f};
+    run_processor_benchmark(state, [side](ParallelProcessor<Pixel>& processor) {
+        benchmark::DoNotOptimize(processor.convolve_separable(side, side, gaussian, gaussian).data());
+    });
+}
+
+void BM_PlanarGrayscale(benchmark::State& state) {
+    ProcessorArguments arguments = processor_arguments(state);
+    size_t side = square_side(arguments.pixels);
+    PlanarImage image = PlanarImage::from_pixels(random_pixels(arguments.pixels), side, side);
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            image.to_grayscale(arguments.pool, arguments.threads);
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetLabel(PixelKernels::implementation());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(arguments.pixels));
+}
+
+// ---------------------------------------------------------------------------
+// StreamingPipeline (ParallelProcessor → 채널 → 소비자 → 비동기 LogFileManager)
+// ---------------------------------------------------------------------------
+
+size_t count_bright(std::span<const Pixel> pixels) {
+    size_t count = 0;
+    for (const Pixel& p : pixels) {
+        count += is_bright(p) ? 1 : 0;
+    }
+    return count;
+}
+
+// range(0) == 0: 구간 결과를 잠금으로 벡터에 모은 뒤 호출한 스레드가 집계하고 기록 (모듈을 따로 이어 붙인 방식)
+// range(0) == 1: StreamingPipeline으로 구간이 끝나는 즉시 채널로 보내 소비자 스레드가 집계하고 기록
+// 반복마다 flushAll로 파일에 기록될 때까지 포함
+void BM_ChunkLogging(benchmark::State& state) {
+    bool streaming = state.range(0) != 0;
+    auto threads = static_cast<unsigned int>(state.range(1));
+    std::vector<Pixel>& image = random_pixels(1 << 20);
+    ParallelProcessor<Pixel> processor(std::span<Pixel>(image), threads, pool_for(threads));
+    processor.set_schedule(Schedule{SchedulePolicy::Dynamic, 4096});
+
+    LogFileManager manager{AsyncOptions{}};
+    std::string path = (scratch_directory() / (streaming ? "streaming.log" : "glued.log")).string();
+    LogFileManager::LogHandle handle = manager.openLogFile(path, FlushPolicy::buffered());
+    StreamingPipeline<size_t> pipeline(manager, handle);
+
+    {
+        PerfScope perf(state);
+        for (auto _ : state) {
+            size_t total = 0;
+            if (streaming) {
+                total = pipeline.run(processor, count_bright, size_t(0), std::plus<>{});
+            } else {
+                std::mutex results_mutex;
+                std::vector<ChunkResult<size_t>> results;
+                processor.for_each_chunk(count_bright, [&](ChunkResult<size_t>&& chunk) {
+                    std::lock_guard<std::mutex> lock(results_mutex);
+                    results.push_back(std::move(chunk));
+                });
+                for (const auto& chunk : results) {
+                    total += chunk.value;
+                    manager.writeRecord(handle, Severity::Info, "chunk start={} end={} runner={} elapsed_us={} value={}", chunk.start, chunk.end,
+                                        chunk.runner, std::chrono::duration_cast<std::chrono::microseconds>(chunk.elapsed).count(), chunk.value);
+                }
+            }
+            manager.flushAll();
+            benchmark::DoNotOptimize(total);
+        }
+    }
+    state.SetLabel(streaming ? "StreamingPipeline" : "vector + 호출 스레드 기록");
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(image.size()));
+    manager.closeLogFile(path);
+    std::filesystem::remove(path);
+}
+
+// ---------------------------------------------------------------------------
+// 스레드 수별 속도 향상 요약
+// ---------------------------------------------------------------------------
+
+// 콘솔 출력은 그대로 두고, 이름에 "threads:N"이 있는 결과를 모아 끝에 효율 표를 출력
+// 효율 = (가장 적은 스레드 수의 시간 × 그 스레드 수) / (시간 × 스레드 수), 1이면 완전한 선형 확장
+class ScalingReporter : public benchmark::ConsoleReporter {
+private:
+    struct Measurement {
+        int64_t threads;
+        double real_time;
+        benchmark::TimeUnit unit;
+    };
+    // (함수 이름과 threads를 뺀 인자) -> 측정 목록 (실행 순서 유지)
+    std::vector<std::pair<std::string, std::vector<Measurement>>> groups;
+
+    static bool split_threads(const std::string& args, std::string& rest, int64_t& threads) {
+        std::stringstream stream(args);
+        std::string part;
+        bool found = false;
+        while (std::getline(stream, part, '/')) {
+            if (part.rfind("threads:", 0) == 0) {
+                threads = std::stoll(part.substr(8));
+                found = true;
+            } else {
+                rest += rest.empty() ? part : "/" + part;
+            }
+        }
+        return found;
+    }
+
+public:
+    void ReportRuns(const std::vector<Run>& reports) override {
+        ConsoleReporter::ReportRuns(reports);
+        for (const Run& run : reports) {
+            if (run.run_type != Run::RT_Iteration || run.error_occurred) {
+                continue;
+            }
+            std::string rest;
+            int64_t threads = 0;
+            if (!split_threads(run.run_name.args, rest, threads)) {
+                continue;
+            }
+            std::string key = run.run_name.function_name + (rest.empty() ? "" : "/" + rest);
+            auto group = std::find_if(groups.begin(), groups.end(), [&key](const auto& entry) { return entry.first == key; });
+            if (group == groups.end()) {
+                groups.emplace_back(key, std::vector<Measurement>());
+                group = groups.end() - 1;
+            }
+            group->second.push_back(Measurement{threads, run.GetAdjustedRealTime(), run.time_unit});
+        }
+    }
+
+    void Finalize() override {
+        ConsoleReporter::Finalize();
+        if (groups.empty()) {
+            return;
+        }
+        std::ostream& out = GetOutputStream();
+        out << "\n스레드 수별 속도 향상 (하드웨어 스레드 " << std::thread::hardware_concurrency() << "개)\n";
+        // setw는 바이트 단위이므로 한글 제목(글자당 3바이트, 화면 2칸)은 글자 수만큼 폭을 늘림
+        out << std::left << std::setw(56 + 4) << "벤치마크" << std::right << std::setw(8 + 3) << "스레드"
+            << std::setw(14 + 2) << "시간" << std::setw(10 + 2) << "향상" << std::setw(10 + 2) << "효율" << "\n";
+        for (const auto& [name, measurements] : groups) {
+            auto base = std::min_element(measurements.begin(), measurements.end(),
+                                         [](const Measurement& a, const Measurement& b) { return a.threads < b.threads; });
+            for (const Measurement& measurement : measurements) {
+                double speedup = base->real_time / measurement.real_time;
+                double efficiency = speedup * static_cast<double>(base->threads) / static_cast<double>(measurement.threads);
+                out << std::left << std::setw(56) << name << std::right << std::setw(8) << measurement.threads
+                    << std::setw(11) << std::fixed << std::setprecision(3) << measurement.real_time << ' '
+                    << benchmark::GetTimeUnitString(measurement.unit)
+                    << std::setw(9) << std::setprecision(2) << speedup << 'x'
+                    << std::setw(9) << std::setprecision(0) << efficiency * 100.0 << '%' << "\n";
+            }
+        }
+        out.unsetf(std::ios::floatfield);
+    }
+};
+
+}  // namespace
+
+// LogFileManager: (방식, 생산자 수), (읽기 방식, 줄 수)
+BENCHMARK(BM_LogWrite)
+    ->ArgsProduct({{static_cast<int64_t>(LogMode::Immediate), static_cast<int64_t>(LogMode::Buffered), static_cast<int64_t>(LogMode::Async)},
+                   thread_counts})
+    ->ArgNames({"mode", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LogRead)
+    ->ArgsProduct({{static_cast<int64_t>(LogRead::ReadAll), static_cast<int64_t>(LogRead::ForEach),
+                    static_cast<int64_t>(LogRead::Tail), static_cast<int64_t>(LogRead::Query)},
+                   {10000, 1000000}})
+    ->ArgNames({"kind", "lines"})
+    ->Unit(benchmark::kMicrosecond);
+
+// CircularBuffer: 용량 (double 기준 2KB, 2MB)
+BENCHMARK_TEMPLATE(BM_CircularPushPop, false)->Arg(256)->Arg(262144);
+BENCHMARK_TEMPLATE(BM_CircularPushPop, true)->Arg(256)->Arg(262144);
+BENCHMARK_TEMPLATE(BM_CircularBulk, false)->Arg(8192)->Arg(262144);
+BENCHMARK_TEMPLATE(BM_CircularBulk, true)->Arg(8192)->Arg(262144);
+BENCHMARK_TEMPLATE(BM_CircularIterate, false)->ArgsProduct({{8192, 262144}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_CircularIterate, true)->ArgsProduct({{8192, 262144}, {0, 1}});
+BENCHMARK(BM_CircularTransfer)->ArgName("threads")->Arg(2)->Arg(4)->Arg(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// ParallelProcessor: (픽셀 수, 스레드 수)
+#define PARALLELPROCESSOR_BENCHMARK(function) \
+    BENCHMARK(function)->ArgsProduct({pixel_counts, thread_counts})->ArgNames({"size", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond)
+
+PARALLELPROCESSOR_BENCHMARK(BM_Process);
+PARALLELPROCESSOR_BENCHMARK(BM_ProcessWithProgress);
+PARALLELPROCESSOR_BENCHMARK(BM_ProcessInPlace);
+PARALLELPROCESSOR_BENCHMARK(BM_MapInto);
+PARALLELPROCESSOR_BENCHMARK(BM_Map);
+PARALLELPROCESSOR_BENCHMARK(BM_Filter);
+PARALLELPROCESSOR_BENCHMARK(BM_CountIf);
+PARALLELPROCESSOR_BENCHMARK(BM_Partition);
+PARALLELPROCESSOR_BENCHMARK(BM_Reduce);
+PARALLELPROCESSOR_BENCHMARK(BM_Pipeline);
+PARALLELPROCESSOR_BENCHMARK(BM_ParallelSort);
+PARALLELPROCESSOR_BENCHMARK(BM_ParallelSortByKey);
+PARALLELPROCESSOR_BENCHMARK(BM_Stencil);
+PARALLELPROCESSOR_BENCHMARK(BM_ConvolveSeparable);
+PARALLELPROCESSOR_BENCHMARK(BM_PlanarGrayscale);
+
+// StreamingPipeline: (방식, 스레드 수)
+BENCHMARK(BM_ChunkLogging)->ArgsProduct({{0, 1}, thread_counts})->ArgNames({"streaming", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // --perf_counters는 Google Benchmark가 모르는 옵션이므로 먼저 꺼냄
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--perf_counters") == 0) {
+            perf_counters_enabled = true;
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    if (perf_counters_enabled) {
+        std::cout << "성능 카운터: " << PerfCounters::describe() << std::endl;
+    }
+    ScalingReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    std::error_code error;
+    std::filesystem::remove_all(scratch_directory(), error);
+    return 0;
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+// 측정 구간의 하드웨어 / 소프트웨어 성능 카운터 (Linux perf_event_open)
+// 풀의 작업자까지 포함하도록 start 시점에 프로세스에 있는 모든 스레드의 카운터를 열어 합산함
+// start 이후에 생긴 스레드는 포함되지 않으므로 스레드 풀과 writer 스레드는 미리 만들어 두어야 함
+// 가상 머신처럼 하드웨어 카운터가 없는 환경에서는 열 수 있는 이벤트만 측정함
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) && defined(COMPONENTBENCHMARK_PERF_COUNTERS)
+#define COMPONENTBENCHMARK_HAVE_PERF_EVENTS
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+#endif
+
+class PerfCounters {
+public:
+    enum Event : size_t {
+        Cycles,
+        Instructions,
+        CacheReferences,
+        CacheMisses,
+        BranchMisses,
+        PageFaults,
+        ContextSwitches,
+        EventCount
+    };
+
+    // 이벤트별 합계 (available이 false인 이벤트는 열 수 없었음)
+    struct Sample {
+        std::array<uint64_t, EventCount> values{};
+        std::array<bool, EventCount> available{};
+
+        bool has(Event event) const {
+            return available[event];
+        }
+
+        uint64_t operator[](Event event) const {
+            return values[event];
+        }
+    };
+
+    PerfCounters() = default;
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+        close_all();
+    }
+
+    // 모든 스레드의 카운터를 열고 0부터 세기 시작 (하나도 열지 못하면 false)
+    bool start() {
+        close_all();
+#ifdef COMPONENTBENCHMARK_HAVE_PERF_EVENTS
+        for (pid_t thread : threads()) {
+            for (size_t event = 0; event < EventCount; ++event) {
+                int descriptor = open_event(static_cast<Event>(event), thread);
+                if (descriptor >= 0) {
+                    descriptors.push_back({static_cast<Event>(event), descriptor});
+                }
+            }
+        }
+        for (const auto& opened : descriptors) {
+            ioctl(opened.descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(opened.descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+        return !descriptors.empty();
+    }
+
+    // 세기를 멈추고 이벤트별 합계를 반환
+    Sample stop() {
+        Sample sample;
+#ifdef COMPONENTBENCHMARK_HAVE_PERF_EVENTS
+        for (const auto& opened : descriptors) {
+            ioctl(opened.descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (const auto& opened : descriptors) {
+            // [값, 활성화된 시간, 실제로 센 시간]: 카운터가 다른 이벤트와 번갈아 쓰였으면 비율로 보정
+            uint64_t values[3] = {0, 0, 0};
+            if (read(opened.descriptor, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) {
+                continue;
+            }
+            uint64_t count = values[0];
+            if (values[2] > 0 && values[2] < values[1]) {
+                count = static_cast<uint64_t>(static_cast<double>(count) * static_cast<double>(values[1]) / static_cast<double>(values[2]));
+            }
+            sample.values[opened.event] += count;
+            sample.available[opened.event] = true;
+        }
+#endif
+        close_all();
+        return sample;
+    }
+
+    // 이 빌드와 환경에서 측정할 수 있는 이벤트 이름 (시작할 때 한 번 안내용)
+    static std::string describe() {
+#ifdef COMPONENTBENCHMARK_HAVE_PERF_EVENTS
+        static const char* const names[EventCount] = {"cycles", "instructions", "cache-references", "cache-misses",
+                                                      "branch-misses", "page-faults", "context-switches"};
+        std::string available;
+        for (size_t event = 0; event < EventCount; ++event) {
+            int descriptor = open_event(static_cast<Event>(event), 0);
+            if (descriptor >= 0) {
+                close(descriptor);
+                available += available.empty() ? "" : ", ";
+                available += names[event];
+            }
+        }
+        return available.empty() ? "사용할 수 있는 이벤트 없음 (perf_event_paranoid 또는 가상화 환경 확인)" : available;
+#else
+        return "이 빌드에서는 사용할 수 없음 (Linux에서 COMPONENTBENCHMARK_PERF_COUNTERS로 빌드)";
+#endif
+    }
+
+private:
+    struct Descriptor {
+        Event event;
+        int descriptor;
+    };
+    std::vector<Descriptor> descriptors;
+
+    void close_all() {
+#ifdef COMPONENTBENCHMARK_HAVE_PERF_EVENTS
+        for (const auto& opened : descriptors) {
+            close(opened.descriptor);
+        }
+#endif
+        descriptors.clear();
+    }
+
+#ifdef COMPONENTBENCHMARK_HAVE_PERF_EVENTS
+    // 사용자 공간에서 실행된 부분만 셈 (perf_event_paranoid 2에서도 자기 프로세스는 측정 가능)
+    static int open_event(Event event, pid_t thread) {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.size = sizeof(attributes);
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        switch (event) {
+        case Cycles:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case Instructions:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case CacheReferences:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_CACHE_REFERENCES;
+            break;
+        case CacheMisses:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case BranchMisses:
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case PageFaults:
+            attributes.type = PERF_TYPE_SOFTWARE;
+            attributes.config = PERF_COUNT_SW_PAGE_FAULTS;
+            break;
+        case ContextSwitches:
+            attributes.type = PERF_TYPE_SOFTWARE;
+            attributes.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+            // 문맥 전환은 커널에서 일어나므로 커널 부분도 셈 (소프트웨어 이벤트는 권한 제한이 없음)
+            attributes.exclude_kernel = 0;
+            break;
+        default:
+            return -1;
+        }
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, thread, -1, -1, 0));
+    }
+
+    // /proc/self/task에 있는 스레드 번호 목록
+    static std::vector<pid_t> threads() {
+        std::vector<pid_t> result;
+        if (DIR* directory = opendir("/proc/self/task")) {
+            while (dirent* entry = readdir(directory)) {
+                if (entry->d_name[0] != '.') {
+                    result.push_back(static_cast<pid_t>(std::atoi(entry->d_name)));
+                }
+            }
+            closedir(directory);
+        }
+        return result;
+    }
+#endif
+};
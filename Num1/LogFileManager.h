@@ -0,0 +1,1956 @@
+#pragma once
+
+#include <fstream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <unordered_map>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <ctime>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <type_traits>
+#include <iterator>
+#include <deque>
+#include <filesystem>
+#include <system_error>
+#ifdef LOGFILEMANAGER_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#include <immintrin.h>
+#define LOGFILEMANAGER_HAVE_SSE2
+#if defined(__GNUC__) || defined(__clang__)
+#define LOGFILEMANAGER_HAVE_AVX2
+#endif
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 비동기 큐가 가득 찼을 때의 처리 정책
+enum class OverflowPolicy {
+    Block,       // 큐에 공간이 생길 때까지 호출 스레드 대기
+    DropNewest,  // 새로 들어온 레코드를 버림
+    DropOldest   // 가장 오래된 레코드를 버리고 새 레코드를 추가
+};
+
+// 비동기 모드 설정
+struct AsyncOptions {
+    size_t queueCapacity = 8192;  // 파일별 큐에 보관할 수 있는 최대 레코드 수 (근사값)
+    size_t batchSize = 256;       // writer 스레드가 파일별로 한 번에 기록하는 최대 레코드 수
+    OverflowPolicy overflowPolicy = OverflowPolicy::Block;
+};
+
+// 타임스탬프의 초 이하 정밀도
+enum class TimestampPrecision {
+    Seconds,       // [YYYY-MM-DD HH:MM:SS]
+    Milliseconds,  // [YYYY-MM-DD HH:MM:SS.mmm]
+    Microseconds   // [YYYY-MM-DD HH:MM:SS.uuuuuu]
+};
+
+// 초 단위 접두부를 캐시하는 타임스탬프 포맷터
+// "[YYYY-MM-DD HH:MM:SS" 부분은 초가 바뀔 때만 localtime으로 다시 만들고,
+// 매 호출은 호출자가 준 버퍼에 복사만 하므로 힙 할당이 없음
+// 한 인스턴스를 여러 스레드에서 동시에 사용하면 안 됨
+class TimestampFormatter {
+public:
+    // "[YYYY-MM-DD HH:MM:SS.uuuuuu] " 길이 + 여유분
+    static constexpr size_t MaxLength = 32;
+
+    explicit TimestampFormatter(TimestampPrecision precision = TimestampPrecision::Seconds)
+        : precision(precision) {}
+
+    TimestampPrecision getPrecision() const {
+        return precision;
+    }
+
+    // out에 "[...] " 형식으로 기록하고 길이 반환 (out은 MaxLength 이상이어야 함)
+    size_t format(std::chrono::system_clock::time_point now, char* out) {
+        using namespace std::chrono;
+        auto sinceEpoch = now.time_since_epoch();
+        auto wholeSeconds = duration_cast<seconds>(sinceEpoch);
+        if (wholeSeconds > sinceEpoch) {
+            wholeSeconds -= seconds(1); // 1970년 이전 시각은 내림 처리
+        }
+
+        std::time_t second = static_cast<std::time_t>(wholeSeconds.count());
+        if (prefixLength == 0 || second != cachedSecond) {
+            renderPrefix(second);
+        }
+
+        std::memcpy(out, prefix, prefixLength);
+        size_t length = prefixLength;
+
+        auto fraction = duration_cast<microseconds>(sinceEpoch - wholeSeconds).count();
+        if (precision == TimestampPrecision::Milliseconds) {
+            out[length++] = '.';
+            length += writeDigits(out + length, static_cast<unsigned>(fraction / 1000), 3);
+        } else if (precision == TimestampPrecision::Microseconds) {
+            out[length++] = '.';
+            length += writeDigits(out + length, static_cast<unsigned>(fraction), 6);
+        }
+
+        out[length++] = ']';
+        out[length++] = ' ';
+        return length;
+    }
+
+private:
+    TimestampPrecision precision;
+    std::time_t cachedSecond = 0;
+    char prefix[MaxLength] = {};
+    size_t prefixLength = 0;
+
+    // 초가 바뀌었을 때만 호출: "[YYYY-MM-DD HH:MM:SS" 생성
+    void renderPrefix(std::time_t second) {
+        std::tm localTime{};
+#ifdef _WIN32
+        localtime_s(&localTime, &second);
+#else
+        localtime_r(&second, &localTime);  // std::localtime은 여러 스레드에서 동시에 호출할 수 없음
+#endif
+        prefix[0] = '[';
+        prefixLength = 1 + std::strftime(prefix + 1, sizeof(prefix) - 1, "%Y-%m-%d %H:%M:%S", &localTime);
+        cachedSecond = second;
+    }
+
+    // value를 width 자리의 0으로 채운 10진수로 기록
+    static size_t writeDigits(char* out, unsigned value, size_t width) {
+        for (size_t i = width; i > 0; --i) {
+            out[i - 1] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        return width;
+    }
+};
+
+// 파일별 flush 정책
+// alwaysFlush가 false이면 아래 조건 중 하나라도 만족할 때 flush
+struct FlushPolicy {
+    bool alwaysFlush = true;                // 기록할 때마다 flush (기존 std::endl 동작)
+    size_t everyRecords = 0;                // N개 레코드마다 flush (0이면 사용 안 함)
+    std::chrono::milliseconds interval{0};  // 마지막 flush 후 T 밀리초가 지나면 flush (0이면 사용 안 함)
+    size_t byteThreshold = 0;               // flush하지 않은 바이트가 이 값 이상이면 flush (0이면 사용 안 함)
+    size_t bufferSize = 0;                  // 스트림의 사용자 공간 버퍼 크기 (0이면 표준 라이브러리 기본값)
+
+    // 레코드마다 flush (error.log처럼 유실되면 안 되는 로그용)
+    static FlushPolicy immediate() {
+        return FlushPolicy();
+    }
+
+    // 큰 버퍼에 모아 두었다가 버퍼가 차거나 interval이 지나면 flush (debug.log, info.log용)
+    static FlushPolicy buffered(size_t bufferSize = 1 << 20,
+                                std::chrono::milliseconds interval = std::chrono::milliseconds(1000)) {
+        FlushPolicy policy;
+        policy.alwaysFlush = false;
+        policy.interval = interval;
+        policy.byteThreshold = bufferSize;
+        policy.bufferSize = bufferSize;
+        return policy;
+    }
+};
+
+// 회전된 로그 파일의 압축 방식
+enum class Compression {
+    None,
+    Gzip   // LOGFILEMANAGER_WITH_ZLIB 정의 및 -lz 링크 필요
+};
+
+// 파일별 로그 회전 정책
+// 회전된 파일은 "파일명.1", "파일명.2", ... 순서로 번호가 커지며 가장 큰 번호가 가장 최근 파일
+struct RotationPolicy {
+    uint64_t maxBytes = 0;            // 파일 크기가 이 값을 넘으면 회전 (0이면 사용 안 함)
+    std::chrono::seconds maxAge{0};   // 파일을 연 뒤(또는 회전 후) 이 시간이 지나면 회전 (0이면 사용 안 함)
+    size_t maxGenerations = 5;        // 보관할 회전 파일 수 (초과분은 오래된 것부터 삭제)
+    Compression compression = Compression::None;
+
+    bool enabled() const {
+        return maxBytes > 0 || maxAge.count() > 0;
+    }
+};
+
+// 로그 파일 저장 형식
+enum class LogFormat {
+    Text,   // "[YYYY-MM-DD HH:MM:SS] message" 형식의 텍스트 (기본값)
+    Binary  // BinaryLog 형식 (포맷은 읽을 때 수행)
+};
+
+// 로그 레코드 심각도 (바이너리 형식에 기록됨)
+enum class Severity : uint8_t {
+    Debug,
+    Info,
+    Warning,
+    Error
+};
+
+// openLogFile 옵션
+struct LogFileOptions {
+    LogFormat format = LogFormat::Text;
+    FlushPolicy flush;
+    RotationPolicy rotation;
+    bool append = false;              // true면 기존 내용 뒤에 이어서 기록, false면 기존 내용을 지움
+    size_t indexInterval = 64 * 1024; // 시간 색인 항목 간격 (바이트, 0이면 색인하지 않음)
+};
+
+// 타임스탬프 → 바이트 위치 희소 색인
+// 기록 스레드가 interval 바이트마다 한 항목씩 추가하고, query는 이진 탐색으로 검색 시작 위치를 찾음
+class SparseTimeIndex {
+public:
+    explicit SparseTimeIndex(size_t interval) : interval(interval) {}
+
+    // 줄을 쓰기 직전에 호출 (기록 권한을 가진 스레드만 호출)
+    void onRecord(std::time_t second, uint64_t offset) {
+        if (interval == 0 || offset < nextOffset) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.push_back(Entry{second, offset});
+        nextOffset = offset + interval;
+    }
+
+    // 파일이 새로 시작될 때(회전) 호출
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        nextOffset = 0;
+    }
+
+    // second보다 이전 시각으로 기록된 마지막 항목의 위치 (없으면 파일 처음)
+    uint64_t offsetBefore(std::time_t second) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = std::partition_point(entries.begin(), entries.end(),
+                                       [second](const Entry& entry) { return entry.second < second; });
+        return it == entries.begin() ? 0 : std::prev(it)->offset;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+private:
+    struct Entry {
+        std::time_t second;
+        uint64_t offset;
+    };
+
+    const size_t interval;
+    uint64_t nextOffset = 0;  // 다음 항목을 추가할 위치 (기록 스레드만 사용)
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+};
+
+// 회전된 로그 파일의 압축과 오래된 세대 삭제를 담당하는 백그라운드 작업자
+// 압축은 시간이 오래 걸릴 수 있으므로 writeLog/writer 스레드와 분리된 스레드에서 수행
+class RotationWorker {
+public:
+    struct Job {
+        std::string basePath;      // 활성 로그 파일 경로
+        std::string segmentPath;   // 회전된 파일 경로 (basePath.N)
+        uint64_t generation;       // 회전된 파일 번호 N
+        size_t maxGenerations;
+        Compression compression;
+    };
+
+    RotationWorker() = default;
+    RotationWorker(const RotationWorker&) = delete;
+    RotationWorker& operator=(const RotationWorker&) = delete;
+
+    // 남은 작업을 모두 처리한 뒤 종료
+    ~RotationWorker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    // 작업 추가 (첫 작업이 들어올 때 스레드 시작)
+    void submit(Job job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        if (!worker.joinable()) {
+            worker = std::thread(&RotationWorker::run, this);
+        }
+        condition.notify_one();
+    }
+
+    // basePath.N 또는 basePath.N.gz 형식의 기존 회전 파일 목록 (번호, 경로)
+    static std::vector<std::pair<uint64_t, std::filesystem::path>> listGenerations(const std::string& basePath) {
+        std::vector<std::pair<uint64_t, std::filesystem::path>> result;
+        std::filesystem::path base(basePath);
+        std::filesystem::path directory = base.parent_path();
+        if (directory.empty()) {
+            directory = ".";
+        }
+        std::string prefix = base.filename().string() + ".";
+
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            std::string name = it->path().filename().string();
+            if (name.size() <= prefix.size() || name.compare(0, prefix.size(), prefix) != 0) {
+                continue;
+            }
+            std::string suffix = name.substr(prefix.size());
+            if (suffix.size() > 3 && suffix.compare(suffix.size() - 3, 3, ".gz") == 0) {
+                suffix.resize(suffix.size() - 3);
+            }
+            if (suffix.empty() || !std::all_of(suffix.begin(), suffix.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+                continue;
+            }
+            result.emplace_back(std::stoull(suffix), it->path());
+        }
+        return result;
+    }
+
+    static bool compressionSupported(Compression compression) {
+#ifdef LOGFILEMANAGER_WITH_ZLIB
+        (void)compression;
+        return true;
+#else
+        return compression == Compression::None;
+#endif
+    }
+
+private:
+    std::deque<Job> jobs;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread worker;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if (jobs.empty()) {
+                break;
+            }
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+            lock.unlock();
+
+            if (job.compression == Compression::Gzip) {
+                compress(job.segmentPath);
+            }
+            prune(job.basePath, job.generation, job.maxGenerations);
+
+            lock.lock();
+        }
+    }
+
+    // 최근 maxGenerations개만 남기고 오래된 회전 파일 삭제
+    static void prune(const std::string& basePath, uint64_t newest, size_t maxGenerations) {
+        for (auto& entry : listGenerations(basePath)) {
+            // 작업이 밀려 더 최근 세대가 이미 있을 수 있으므로 뺄셈 대신 덧셈으로 비교
+            if (entry.first + maxGenerations <= newest) {
+                std::error_code ec;
+                std::filesystem::remove(entry.second, ec);
+            }
+        }
+    }
+
+    // path를 path.gz로 압축하고 원본 삭제 (임시 파일에 쓴 뒤 이름 변경)
+    static bool compress(const std::string& path) {
+#ifdef LOGFILEMANAGER_WITH_ZLIB
+        std::ifstream input(path, std::ios::binary);
+        if (!input.is_open()) {
+            return false;
+        }
+        std::string target = path + ".gz";
+        std::string temporary = target + ".tmp";
+        gzFile output = gzopen(temporary.c_str(), "wb6");
+        if (output == nullptr) {
+            return false;
+        }
+
+        std::vector<char> buffer(1 << 16);
+        bool ok = true;
+        while (ok && input) {
+            input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            std::streamsize count = input.gcount();
+            if (count > 0 && gzwrite(output, buffer.data(), static_cast<unsigned>(count)) != count) {
+                ok = false;
+            }
+        }
+        ok = (gzclose(output) == Z_OK) && ok;
+        input.close();
+
+        std::error_code ec;
+        if (ok) {
+            std::filesystem::rename(temporary, target, ec);
+            ok = !ec;
+        }
+        if (ok) {
+            std::filesystem::remove(path, ec);
+        } else {
+            std::filesystem::remove(temporary, ec);
+        }
+        return ok;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+};
+
+// 바이너리 로그 형식과 인코딩 / 디코딩
+// 파일: "RGTBLOG1"(8바이트) 뒤에 레코드가 이어짐
+// 레코드 헤더(16바이트, 호스트 바이트 순서):
+//   [uint64 epoch 나노초][uint32 payload 길이][uint8 심각도][uint8 여분][uint16 여분]
+// payload: [uint32 형식 문자열 길이][형식 문자열][uint8 인자 수][인자...]
+// 인자: [uint8 타입][값] (Int64/UInt64/Double: 8바이트, Bool: 1바이트, String: uint32 길이 + 바이트)
+// 기록 시에는 인자 값만 복사하고, "{}" 자리에 인자를 넣는 포맷은 디코딩할 때 수행
+class BinaryLog {
+public:
+    static constexpr char Magic[8] = {'R', 'G', 'T', 'B', 'L', 'O', 'G', '1'};
+    static constexpr size_t MagicSize = sizeof(Magic);
+    static constexpr size_t HeaderSize = 16;
+
+    struct Record {
+        std::chrono::system_clock::time_point time;
+        Severity severity;
+        std::string_view payload;
+    };
+
+    // 형식 문자열과 인자를 payload로 인코딩 (out 뒤에 추가)
+    template <typename... Args>
+    static void encode(std::string& out, std::string_view format, const Args&... args) {
+        static_assert(sizeof...(Args) <= 255, "인자는 최대 255개");
+        appendRaw(out, static_cast<uint32_t>(format.size()));
+        out.append(format.data(), format.size());
+        out.push_back(static_cast<char>(sizeof...(Args)));
+        (appendArgument(out, args), ...);
+    }
+
+    static void writeHeader(char* out, std::chrono::system_clock::time_point time, Severity severity, uint32_t payloadLength) {
+        int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        std::memcpy(out, &nanoseconds, 8);
+        std::memcpy(out + 8, &payloadLength, 4);
+        out[12] = static_cast<char>(severity);
+        out[13] = out[14] = out[15] = 0;
+    }
+
+    static bool isBinaryLog(const char* data, size_t size) {
+        return size >= MagicSize && std::memcmp(data, Magic, MagicSize) == 0;
+    }
+
+    // payload의 "{}"를 인자 값으로 바꾼 텍스트를 out 뒤에 추가 (형식이 잘못되면 false)
+    static bool formatPayload(std::string_view payload, std::string& out) {
+        Cursor cursor{payload.data(), payload.data() + payload.size()};
+        uint32_t formatLength;
+        uint8_t argumentCount;
+        if (!cursor.read(formatLength) || static_cast<size_t>(cursor.end - cursor.position) < formatLength) {
+            return false;
+        }
+        std::string_view format(cursor.position, formatLength);
+        cursor.position += formatLength;
+        if (!cursor.read(argumentCount)) {
+            return false;
+        }
+
+        size_t remaining = argumentCount;
+        size_t start = 0;
+        while (true) {
+            size_t placeholder = remaining > 0 ? format.find("{}", start) : std::string_view::npos;
+            if (placeholder == std::string_view::npos) {
+                out.append(format.data() + start, format.size() - start);
+                return true;
+            }
+            out.append(format.data() + start, placeholder - start);
+            if (!formatArgument(cursor, out)) {
+                return false;
+            }
+            --remaining;
+            start = placeholder + 2;
+        }
+    }
+
+    // data[offset, size)의 레코드를 차례로 callback(const Record&)에 전달 (callback이 false를 반환하면 중단)
+    // offset은 레코드 시작 위치여야 하며, 잘린 레코드를 만나면 중단
+    template <typename Callback>
+    static void forEachRecord(const char* data, size_t size, size_t offset, Callback&& callback) {
+        if (offset < MagicSize) {
+            offset = MagicSize;
+        }
+        while (size - offset >= HeaderSize) {
+            const char* header = data + offset;
+            uint32_t payloadLength = readPayloadLength(header);
+            if (size - offset - HeaderSize < payloadLength) {
+                return;
+            }
+            if (!callback(decodeHeader(header, std::string_view(header + HeaderSize, payloadLength)))) {
+                return;
+            }
+            offset += HeaderSize + payloadLength;
+        }
+    }
+
+    // input의 offset 위치부터 레코드를 하나씩 읽어 callback(const Record&)에 전달 (callback이 false를 반환하면 중단)
+    // 파일을 매핑할 수 없을 때 사용하며, 파일 전체를 읽지 않고 payload 버퍼만 가장 긴 레코드 크기까지 재사용
+    // 매핑한 경우와 같이 남은 크기보다 긴 payload는 잘린 레코드로 보고 중단 (손상된 길이로 큰 버퍼를 잡지 않음)
+    template <typename Callback>
+    static void forEachRecord(std::istream& input, uint64_t offset, Callback&& callback) {
+        input.clear();
+        input.seekg(0, std::ios::end);
+        std::streamoff end = input.tellg();
+        if (end < 0) {
+            return;
+        }
+        const uint64_t size = static_cast<uint64_t>(end);
+        offset = std::max<uint64_t>(offset, MagicSize);
+        input.seekg(static_cast<std::streamoff>(offset));
+        char header[HeaderSize];
+        std::string payload;
+        while (size >= offset && size - offset >= HeaderSize && input.read(header, HeaderSize)) {
+            uint32_t payloadLength = readPayloadLength(header);
+            if (size - offset - HeaderSize < payloadLength) {
+                return;
+            }
+            payload.resize(payloadLength);
+            if (!input.read(payload.data(), static_cast<std::streamsize>(payloadLength))) {
+                return;
+            }
+            if (!callback(decodeHeader(header, payload))) {
+                return;
+            }
+            offset += HeaderSize + payloadLength;
+        }
+    }
+
+    // 레코드를 텍스트 로그와 같은 "[YYYY-MM-DD HH:MM:SS] message" 형식 줄로 변환해
+    // callback(std::string_view)에 전달 (줄 버퍼는 재사용되므로 보관하려면 복사해야 함)
+    template <typename Callback>
+    static void forEachLine(const char* data, size_t size, size_t offset, TimestampFormatter& formatter, Callback&& callback) {
+        std::string line;
+        forEachRecord(data, size, offset, [&](const Record& record) {
+            return static_cast<bool>(callback(formatLine(record, formatter, line)));
+        });
+    }
+
+    // 스트림 버전 (파일을 매핑할 수 없을 때)
+    template <typename Callback>
+    static void forEachLine(std::istream& input, uint64_t offset, TimestampFormatter& formatter, Callback&& callback) {
+        std::string line;
+        forEachRecord(input, offset, [&](const Record& record) {
+            return static_cast<bool>(callback(formatLine(record, formatter, line)));
+        });
+    }
+
+    // 바이너리 로그 파일을 텍스트 로그 파일로 변환
+    static bool decodeToText(const std::string& binaryPath, const std::string& textPath,
+                             TimestampPrecision precision = TimestampPrecision::Seconds);
+
+private:
+    static uint32_t readPayloadLength(const char* header) {
+        uint32_t payloadLength;
+        std::memcpy(&payloadLength, header + 8, 4);
+        return payloadLength;
+    }
+
+    // 16바이트 헤더와 payload로 레코드 구성
+    static Record decodeHeader(const char* header, std::string_view payload) {
+        int64_t nanoseconds;
+        std::memcpy(&nanoseconds, header, 8);
+        Record record;
+        record.time = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+        record.severity = static_cast<Severity>(header[12]);
+        record.payload = payload;
+        return record;
+    }
+
+    // 레코드를 "[YYYY-MM-DD HH:MM:SS] message" 줄로 line에 만들고 반환
+    static std::string_view formatLine(const Record& record, TimestampFormatter& formatter, std::string& line) {
+        char timestamp[TimestampFormatter::MaxLength];
+        line.assign(timestamp, formatter.format(record.time, timestamp));
+        if (!formatPayload(record.payload, line)) {
+            line.append("<잘못된 레코드>");
+        }
+        return line;
+    }
+
+    enum ArgumentType : uint8_t {
+        Int64 = 1,
+        UInt64,
+        Double,
+        Bool,
+        String
+    };
+
+    struct Cursor {
+        const char* position;
+        const char* end;
+
+        template <typename T>
+        bool read(T& value) {
+            if (static_cast<size_t>(end - position) < sizeof(T)) {
+                return false;
+            }
+            std::memcpy(&value, position, sizeof(T));
+            position += sizeof(T);
+            return true;
+        }
+    };
+
+    template <typename T>
+    static void appendRaw(std::string& out, T value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        out.append(bytes, sizeof(T));
+    }
+
+    template <typename T>
+    static void appendArgument(std::string& out, const T& value) {
+        using Type = std::decay_t<T>;
+        if constexpr (std::is_same_v<Type, bool>) {
+            out.push_back(static_cast<char>(Bool));
+            out.push_back(value ? 1 : 0);
+        } else if constexpr (std::is_same_v<Type, char>) {
+            appendString(out, std::string_view(&value, 1));
+        } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            out.push_back(static_cast<char>(Int64));
+            appendRaw(out, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<Type>) {
+            out.push_back(static_cast<char>(UInt64));
+            appendRaw(out, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_floating_point_v<Type>) {
+            out.push_back(static_cast<char>(Double));
+            appendRaw(out, static_cast<double>(value));
+        } else {
+            static_assert(std::is_convertible_v<const T&, std::string_view>, "지원하지 않는 인자 타입");
+            appendString(out, std::string_view(value));
+        }
+    }
+
+    static void appendString(std::string& out, std::string_view value) {
+        out.push_back(static_cast<char>(String));
+        appendRaw(out, static_cast<uint32_t>(value.size()));
+        out.append(value.data(), value.size());
+    }
+
+    static bool formatArgument(Cursor& cursor, std::string& out) {
+        uint8_t type;
+        if (!cursor.read(type)) {
+            return false;
+        }
+
+        char buffer[64];
+        std::to_chars_result result{buffer, std::errc()};
+        switch (type) {
+        case Int64: {
+            int64_t value;
+            if (!cursor.read(value)) {
+                return false;
+            }
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            break;
+        }
+        case UInt64: {
+            uint64_t value;
+            if (!cursor.read(value)) {
+                return false;
+            }
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            break;
+        }
+        case Double: {
+            double value;
+            if (!cursor.read(value)) {
+                return false;
+            }
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            break;
+        }
+        case Bool: {
+            uint8_t value;
+            if (!cursor.read(value)) {
+                return false;
+            }
+            out.append(value ? "true" : "false");
+            return true;
+        }
+        case String: {
+            uint32_t length;
+            if (!cursor.read(length) || static_cast<size_t>(cursor.end - cursor.position) < length) {
+                return false;
+            }
+            out.append(cursor.position, length);
+            cursor.position += length;
+            return true;
+        }
+        default:
+            return false;
+        }
+
+        if (result.ec != std::errc()) {
+            return false;
+        }
+        out.append(buffer, result.ptr - buffer);
+        return true;
+    }
+};
+
+// 기록 대기 중인 로그 레코드
+// 텍스트 파일은 message에 포맷된 메시지를, 바이너리 파일은 BinaryLog payload를 담음
+struct PendingRecord {
+    std::chrono::system_clock::time_point time;  // writeLog 호출 시점
+    std::string message;
+    Severity severity = Severity::Info;
+};
+
+// 다중 생산자 / 단일 소비자 lock-free 큐 (Vyukov 방식의 연결 리스트)
+// push는 여러 스레드에서 동시에 호출 가능, pop은 한 번에 한 스레드만 호출해야 함
+class PendingQueue {
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        PendingRecord record;
+    };
+
+    std::atomic<Node*> head;  // 생산자 쪽 (마지막에 추가된 노드)
+    Node* tail;               // 소비자 쪽 (더미 노드)
+
+public:
+    PendingQueue() {
+        Node* stub = new Node();
+        head.store(stub);
+        tail = stub;
+    }
+
+    ~PendingQueue() {
+        while (tail) {
+            Node* next = tail->next.load();
+            delete tail;
+            tail = next;
+        }
+    }
+
+    PendingQueue(const PendingQueue&) = delete;
+    PendingQueue& operator=(const PendingQueue&) = delete;
+
+    void push(PendingRecord&& record) {
+        Node* node = new Node();
+        node->record = std::move(record);
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // 꺼낼 레코드가 없거나 생산자가 연결을 마치지 않았으면 false
+    bool pop(PendingRecord& out) {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        out = std::move(next->record);
+        delete tail;
+        tail = next;
+        return true;
+    }
+};
+
+// 줄 끝의 '\r' 제거 ('\r\n' 개행 파일 지원)
+inline std::string_view trimCarriageReturn(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+// 64바이트 블록 단위로 '\n' 위치를 비트마스크로 찾는 SIMD 줄 스캐너
+// CPU 지원 여부를 한 번만 확인해 AVX2 / SSE2 / 스칼라 구현 중 하나를 선택하고,
+// 간접 호출은 줄마다가 아니라 64바이트마다 한 번만 발생
+class NewlineScanner {
+public:
+    using MaskFunction = uint64_t (*)(const char* block);
+
+    // data[0, size)를 줄 단위로 callback(std::string_view)에 전달 (callback이 false를 반환하면 중단)
+    template <typename Callback>
+    static void forEachLine(const char* data, size_t size, Callback&& callback) {
+        static const MaskFunction mask = select();
+
+        const char* lineStart = data;
+        const char* block = data;
+        const char* end = data + size;
+        while (end - block >= 64) {
+            for (uint64_t bits = mask(block); bits != 0; bits &= bits - 1) {
+                const char* newline = block + countTrailingZeros(bits);
+                if (!callback(trimCarriageReturn(std::string_view(lineStart, newline - lineStart)))) {
+                    return;
+                }
+                lineStart = newline + 1;
+            }
+            block += 64;
+        }
+
+        // 64바이트 미만으로 남은 부분
+        while (lineStart < end) {
+            const char* newline = static_cast<const char*>(std::memchr(block, '\n', end - block));
+            if (newline == nullptr) {
+                callback(trimCarriageReturn(std::string_view(lineStart, end - lineStart))); // 마지막 줄에 개행이 없는 경우
+                return;
+            }
+            if (!callback(trimCarriageReturn(std::string_view(lineStart, newline - lineStart)))) {
+                return;
+            }
+            lineStart = block = newline + 1;
+        }
+    }
+
+    // 사용 중인 구현 이름 ("avx2", "sse2", "scalar")
+    static const char* implementation() {
+        MaskFunction mask = select();
+#ifdef LOGFILEMANAGER_HAVE_AVX2
+        if (mask == &maskAvx2) {
+            return "avx2";
+        }
+#endif
+#ifdef LOGFILEMANAGER_HAVE_SSE2
+        if (mask == &maskSse2) {
+            return "sse2";
+        }
+#endif
+        return "scalar";
+    }
+
+private:
+    static MaskFunction select() {
+#ifdef LOGFILEMANAGER_HAVE_AVX2
+        if (__builtin_cpu_supports("avx2")) {
+            return &maskAvx2;
+        }
+#endif
+#ifdef LOGFILEMANAGER_HAVE_SSE2
+        return &maskSse2;
+#else
+        return &maskScalar;
+#endif
+    }
+
+    static unsigned countTrailingZeros(uint64_t bits) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctzll(bits));
+#endif
+    }
+
+    static uint64_t maskScalar(const char* block) {
+        uint64_t bits = 0;
+        for (unsigned i = 0; i < 64; ++i) {
+            bits |= static_cast<uint64_t>(block[i] == '\n') << i;
+        }
+        return bits;
+    }
+
+#ifdef LOGFILEMANAGER_HAVE_SSE2
+    static uint64_t maskSse2(const char* block) {
+        const __m128i newline = _mm_set1_epi8('\n');
+        uint64_t bits = 0;
+        for (unsigned i = 0; i < 4; ++i) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));
+            uint64_t chunkBits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)));
+            bits |= chunkBits << (i * 16);
+        }
+        return bits;
+    }
+#endif
+
+#ifdef LOGFILEMANAGER_HAVE_AVX2
+    __attribute__((target("avx2")))
+    static uint64_t maskAvx2(const char* block) {
+        const __m256i newline = _mm256_set1_epi8('\n');
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+        uint64_t lowBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, newline)));
+        uint64_t highBits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, newline)));
+        return lowBits | (highBits << 32);
+    }
+#endif
+};
+
+// 로그 파일 전체를 읽기 전용으로 메모리에 매핑 (Linux: mmap, Windows: MapViewOfFile)
+// 줄은 매핑된 메모리를 직접 가리키므로 복사가 없으며, 객체가 살아 있는 동안 유효
+class MappedLogFile {
+public:
+    explicit MappedLogFile(const std::string& filename) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                 nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize)) {
+            return;
+        }
+        length = static_cast<size_t>(fileSize.QuadPart);
+        opened = true;
+        if (length == 0) {
+            return; // 빈 파일은 매핑할 수 없으므로 크기 0으로 처리
+        }
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr) {
+            opened = false;
+            return;
+        }
+        address = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        opened = (address != nullptr);
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat status;
+        if (::fstat(fd, &status) == 0) {
+            length = static_cast<size_t>(status.st_size);
+            opened = true;
+            if (length > 0) {
+                void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapped == MAP_FAILED) {
+                    opened = false;
+                } else {
+                    address = static_cast<const char*>(mapped);
+                    ::madvise(mapped, length, MADV_SEQUENTIAL); // 순차 읽기 미리 읽기 힌트
+                }
+            }
+        }
+        ::close(fd); // 매핑은 파일 디스크립터를 닫아도 유지됨
+#endif
+    }
+
+    ~MappedLogFile() {
+#ifdef _WIN32
+        if (address != nullptr) {
+            UnmapViewOfFile(address);
+        }
+        if (mappingHandle != nullptr) {
+            CloseHandle(mappingHandle);
+        }
+        if (fileHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle);
+        }
+#else
+        if (address != nullptr) {
+            ::munmap(const_cast<char*>(address), length);
+        }
+#endif
+    }
+
+    MappedLogFile(const MappedLogFile&) = delete;
+    MappedLogFile& operator=(const MappedLogFile&) = delete;
+
+    bool is_open() const {
+        return opened;
+    }
+
+    const char* data() const {
+        return address;
+    }
+
+    size_t size() const {
+        return address != nullptr ? length : 0;
+    }
+
+    // 매핑된 내용을 줄 단위로 callback(std::string_view)에 전달 (callback이 false를 반환하면 중단)
+    template <typename Callback>
+    void forEachLine(Callback&& callback) const {
+        if (address != nullptr) {
+            NewlineScanner::forEachLine(address, length, std::forward<Callback>(callback));
+        }
+    }
+
+private:
+    const char* address = nullptr;
+    size_t length = 0;
+    bool opened = false;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+};
+
+// 재사용 버퍼로 로그 파일을 한 줄씩 읽는 스트리밍 리더
+// 줄마다 std::string을 만들지 않고 내부 버퍼를 가리키는 std::string_view를 반환
+// next()가 반환한 줄은 다음 next()/seek() 호출 전까지만 유효
+class LogReader {
+public:
+    explicit LogReader(const std::string& filename, size_t bufferSize = 64 * 1024)
+        : file(filename, std::ios::binary), buffer(bufferSize == 0 ? 1 : bufferSize) {}
+
+    bool is_open() const {
+        return file.is_open();
+    }
+
+    // 다음 줄 읽기 (줄 끝의 '\n', '\r\n'은 제외), 더 읽을 줄이 없으면 false
+    bool next(std::string_view& line) {
+        while (true) {
+            const char* first = buffer.data() + begin;
+            const void* newline = begin < end ? std::memchr(first, '\n', end - begin) : nullptr;
+            if (newline != nullptr) {
+                size_t length = static_cast<const char*>(newline) - first;
+                begin += length + 1;
+                line = trimCarriageReturn(std::string_view(first, length));
+                return true;
+            }
+
+            if (eof) {
+                if (begin == end) {
+                    return false;
+                }
+                // 마지막 줄에 개행이 없는 경우
+                line = trimCarriageReturn(std::string_view(first, end - begin));
+                begin = end;
+                return true;
+            }
+            fill();
+        }
+    }
+
+    // 앞에서부터 count줄 건너뛰기, 실제로 건너뛴 줄 수 반환
+    size_t skip(size_t count) {
+        std::string_view line;
+        size_t skipped = 0;
+        while (skipped < count && next(line)) {
+            ++skipped;
+        }
+        return skipped;
+    }
+
+    // 바이트 위치로 이동 (줄의 시작 위치를 지정해야 함)
+    bool seek(uint64_t offset) {
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(offset));
+        begin = end = 0;
+        eof = false;
+        return !file.fail();
+    }
+
+private:
+    std::ifstream file;
+    std::vector<char> buffer;
+    size_t begin = 0;  // 아직 반환하지 않은 데이터 시작
+    size_t end = 0;    // 버퍼에 읽어 둔 데이터 끝
+    bool eof = false;
+
+    // 남은 데이터를 버퍼 앞으로 옮기고 이어서 읽음 (한 줄이 버퍼보다 길면 버퍼를 늘림)
+    void fill() {
+        if (begin > 0) {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        file.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+        std::streamsize count = file.gcount();
+        end += static_cast<size_t>(count);
+        if (count == 0) {
+            eof = true;
+        }
+    }
+};
+
+inline bool BinaryLog::decodeToText(const std::string& binaryPath, const std::string& textPath, TimestampPrecision precision) {
+    MappedLogFile mapped(binaryPath);
+    if (!mapped.is_open() || !isBinaryLog(mapped.data(), mapped.size())) {
+        return false;
+    }
+    std::ofstream output(textPath, std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        return false;
+    }
+
+    TimestampFormatter formatter(precision);
+    forEachLine(mapped.data(), mapped.size(), 0, formatter, [&output](std::string_view line) {
+        output.write(line.data(), static_cast<std::streamsize>(line.size()));
+        output.put('\n');
+        return static_cast<bool>(output);
+    });
+    output.flush();
+    return static_cast<bool>(output);
+}
+
+// 파일명 조회용 해시: std::string_view / const char*로도 임시 std::string 없이 조회 가능
+struct TransparentStringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view value) const noexcept {
+        return std::hash<std::string_view>{}(value);
+    }
+};
+
+class LogFileManager {
+private:
+    // 열린 로그 파일 하나의 상태
+    // 생산자는 pending 큐에 레코드를 넣기만 하고, draining 플래그를 얻은 한 스레드가 스트림에 기록
+    struct LogFile {
+        const std::string path;
+        std::unique_ptr<char[]> streamBuffer;  // stream보다 먼저 선언 (stream이 먼저 소멸되어야 함)
+        std::ofstream stream;
+        PendingQueue pending;
+        std::atomic<uint64_t> enqueued{0};   // 큐에 넣은 레코드 수 (누적)
+        std::atomic<uint64_t> consumed{0};   // 기록되거나 버려진 레코드 수 (누적)
+        std::atomic<bool> draining{false};   // 스트림 기록 권한
+        std::atomic<bool> closed{false};
+        std::atomic<bool> writeFailed{false}; // 마지막 기록 실패 여부 (기록 권한 없이 읽기 가능)
+        TimestampFormatter timestamp;        // 기록 권한을 가진 스레드만 사용
+        const FlushPolicy flushPolicy;
+        const RotationPolicy rotationPolicy;
+        const LogFormat format;
+
+        // flush 정책 상태 (기록 권한을 가진 스레드만 사용)
+        size_t unflushedRecords = 0;
+        size_t unflushedBytes = 0;
+        std::chrono::steady_clock::time_point lastFlush = std::chrono::steady_clock::now();
+
+        // 회전 정책 상태 (기록 권한을 가진 스레드만 사용)
+        uint64_t bytesWritten = 0;   // 현재 파일 크기
+        uint64_t rotationBase = 0;   // 크기 기준을 셀 시작 위치 (이름 변경에 실패하면 그때의 크기부터 다시 셈)
+        uint64_t generation = 0;     // 마지막으로 회전된 파일 번호
+        std::chrono::steady_clock::time_point openedAt = std::chrono::steady_clock::now();
+
+        SparseTimeIndex index;
+
+        LogFile(const std::string& path, TimestampPrecision precision, const LogFileOptions& options)
+            : path(path), timestamp(precision), flushPolicy(options.flush), rotationPolicy(options.rotation),
+              format(options.format), index(options.indexInterval) {
+            // 버퍼는 open 전에 지정해야 적용됨
+            if (flushPolicy.bufferSize > 0) {
+                streamBuffer = std::make_unique<char[]>(flushPolicy.bufferSize);
+                stream.rdbuf()->pubsetbuf(streamBuffer.get(), static_cast<std::streamsize>(flushPolicy.bufferSize));
+            }
+        }
+
+        // 레코드 수 / 바이트 기준 flush 조건
+        bool thresholdReached() const {
+            return (flushPolicy.everyRecords > 0 && unflushedRecords >= flushPolicy.everyRecords) ||
+                   (flushPolicy.byteThreshold > 0 && unflushedBytes >= flushPolicy.byteThreshold);
+        }
+
+        // 시간 기준 flush 조건
+        bool intervalElapsed(std::chrono::steady_clock::time_point now) const {
+            return flushPolicy.interval.count() > 0 && now - lastFlush >= flushPolicy.interval;
+        }
+
+        void flush() {
+            stream.flush();
+            unflushedRecords = 0;
+            unflushedBytes = 0;
+            lastFlush = std::chrono::steady_clock::now();
+        }
+
+        bool hasPending() const {
+            return consumed.load() < enqueued.load();
+        }
+
+        size_t pendingCount() const {
+            uint64_t done = consumed.load();
+            uint64_t total = enqueued.load();
+            return total > done ? static_cast<size_t>(total - done) : 0;
+        }
+    };
+
+    // 로그 파일 관리 맵 (파일명, 파일 상태)
+    // 조회(writeLog, readLogs)는 공유 잠금, 열기/닫기만 배타 잠금을 사용
+    std::unordered_map<std::string, std::shared_ptr<LogFile>, TransparentStringHash, std::equal_to<>> logFiles;
+    mutable std::shared_mutex filesMutex;
+    std::atomic<uint64_t> filesVersion{0};  // 맵이 바뀔 때마다 증가 (writer 스레드의 스냅샷 갱신용)
+    TimestampPrecision timestampPrecision = TimestampPrecision::Seconds;
+
+    // 비동기 모드 상태
+    bool asyncMode = false;
+    AsyncOptions asyncOptions;
+    std::atomic<bool> stopping{false};
+    std::atomic<bool> workSignal{false};     // 새 레코드가 들어왔음을 writer 스레드에 알림
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::atomic<size_t> blockedProducers{0}; // Block 정책으로 대기 중인 생산자 수
+    std::mutex spaceMutex;
+    std::condition_variable spaceCondition;
+    std::atomic<size_t> droppedCount{0};
+    std::atomic<size_t> rotationFailures{0};
+    RotationWorker rotationWorker;
+    std::thread writerThread;
+    
+    // 파일명으로 파일 상태 조회 (공유 잠금)
+    std::shared_ptr<LogFile> findFile(std::string_view filename) const {
+        std::shared_lock<std::shared_mutex> lock(filesMutex);
+        auto it = logFiles.find(filename);
+        if (it == logFiles.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    // 현재 파일을 파일명.N으로 바꾸고 새 파일을 열어 기록 계속 (기록 권한을 가진 스레드에서 호출)
+    // 압축과 오래된 세대 삭제는 rotationWorker에 넘기므로 기록 경로는 이름 변경만 기다림
+    void rotate(LogFile& file) {
+        file.flush();
+        file.stream.close();
+
+        uint64_t generation = file.generation + 1;
+        std::string segment = file.path + "." + std::to_string(generation);
+        std::error_code ec;
+        std::filesystem::rename(file.path, segment, ec);
+
+        // 이름 변경에 실패하면 기존 파일에 이어서 기록하고, 레코드마다 다시 시도하지 않도록
+        // maxBytes / maxAge만큼 더 기록한 뒤에 다시 회전
+        file.stream.open(file.path, ec ? std::ios::app : std::ios::trunc);
+        file.openedAt = std::chrono::steady_clock::now();
+        if (ec) {
+            file.rotationBase = file.bytesWritten;
+            ++rotationFailures;
+            return;
+        }
+        file.generation = generation;
+        file.bytesWritten = 0;
+        file.rotationBase = 0;
+        file.index.clear();
+
+        rotationWorker.submit(RotationWorker::Job{
+            file.path, segment, generation, file.rotationPolicy.maxGenerations, file.rotationPolicy.compression});
+    }
+
+    // 기록 권한을 얻으면 대기 중인 레코드를 최대 limit개까지 기록하고 flush 정책 적용
+    // 다른 스레드가 이미 기록 중이면 아무것도 하지 않고 false 반환
+    bool tryDrain(LogFile& file, size_t limit, bool forceFlush = false) {
+        if (file.draining.exchange(true)) {
+            return false;
+        }
+
+        const RotationPolicy& rotation = file.rotationPolicy;
+        if (rotation.maxAge.count() > 0 && file.bytesWritten > 0 && file.hasPending() &&
+            std::chrono::steady_clock::now() - file.openedAt >= rotation.maxAge) {
+            rotate(file);
+        }
+
+        size_t count = 0;
+        PendingRecord record;
+        char timestamp[TimestampFormatter::MaxLength];
+        const bool binary = (file.format == LogFormat::Binary);
+        while (count < limit && file.pending.pop(record)) {
+            // 텍스트: 타임스탬프 + 메시지 + 개행, 바이너리: 고정 헤더 + payload
+            size_t length = binary ? BinaryLog::HeaderSize : file.timestamp.format(record.time, timestamp);
+            size_t recordBytes = length + record.message.size() + (binary ? 0 : 1);
+            if (rotation.maxBytes > 0 && file.bytesWritten > file.rotationBase &&
+                file.bytesWritten - file.rotationBase + recordBytes > rotation.maxBytes) {
+                rotate(file);
+            }
+            if (binary && file.bytesWritten == 0) {
+                file.stream.write(BinaryLog::Magic, BinaryLog::MagicSize);
+                file.bytesWritten += BinaryLog::MagicSize;
+                file.unflushedBytes += BinaryLog::MagicSize;
+            }
+            file.index.onRecord(std::chrono::system_clock::to_time_t(record.time), file.bytesWritten);
+
+            if (binary) {
+                BinaryLog::writeHeader(timestamp, record.time, record.severity, static_cast<uint32_t>(record.message.size()));
+            }
+            file.stream.write(timestamp, length);
+            file.stream.write(record.message.data(), record.message.size());
+            if (!binary) {
+                file.stream.put('\n');
+            }
+            ++count;
+
+            file.bytesWritten += recordBytes;
+            ++file.unflushedRecords;
+            file.unflushedBytes += recordBytes;
+            if (!file.flushPolicy.alwaysFlush && file.thresholdReached()) {
+                file.flush();
+            }
+        }
+
+        // 한 번에 모아서 기록한 뒤 flush (alwaysFlush면 반환 시점에 모든 레코드가 디스크로 넘어감)
+        if (file.unflushedRecords > 0 &&
+            (forceFlush || file.flushPolicy.alwaysFlush || file.intervalElapsed(std::chrono::steady_clock::now()))) {
+            file.flush();
+        }
+        file.writeFailed.store(file.stream.fail());
+        if (count > 0) {
+            file.consumed.fetch_add(count);
+        }
+
+        file.draining.store(false);
+        return true;
+    }
+
+    // 동기 모드 기록: 기록 권한을 얻은 스레드가 자신과 다른 스레드의 레코드를 함께 기록
+    // 권한을 얻지 못한 스레드는 바로 반환하고, 권한을 가진 스레드가 해제 후 남은 레코드를 다시 확인
+    void drainPending(LogFile& file) {
+        while (file.hasPending() && tryDrain(file, SIZE_MAX)) {
+        }
+    }
+
+    // 호출 시점까지 큐에 들어간 레코드가 모두 기록될 때까지 대기
+    void waitForDrain(LogFile& file) {
+        uint64_t target = file.enqueued.load();
+        while (file.consumed.load() < target) {
+            if (!tryDrain(file, SIZE_MAX)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // 대기 중인 레코드를 모두 기록한 뒤 버퍼를 비움
+    void flushFile(LogFile& file) {
+        waitForDrain(file);
+        while (!tryDrain(file, 0, true)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // 메시지 한 건 기록 (writeLog의 파일명 / 핸들 버전 공용)
+    bool writeMessage(LogFile* file, std::string_view message) {
+        try {
+            if (file == nullptr || file->closed.load()) {
+                return false; // 파일이 열려있지 않음
+            }
+
+            PendingRecord record{std::chrono::system_clock::now(), std::string(), Severity::Info};
+            if (file->format == LogFormat::Binary) {
+                BinaryLog::encode(record.message, message);
+            } else {
+                record.message = message;
+            }
+            return submit(*file, std::move(record));
+        } catch (...) {
+            return false; // 예외 발생 시 실패
+        }
+    }
+
+    // 형식 문자열 레코드 한 건 기록 (writeRecord의 파일명 / 핸들 버전 공용)
+    template <typename... Args>
+    bool writeFormatted(LogFile* file, Severity severity, std::string_view format, const Args&... args) {
+        try {
+            if (file == nullptr || file->closed.load()) {
+                return false; // 파일이 열려있지 않음
+            }
+
+            PendingRecord record{std::chrono::system_clock::now(), std::string(), severity};
+            if (file->format == LogFormat::Binary) {
+                BinaryLog::encode(record.message, format, args...);
+            } else {
+                std::string payload;
+                BinaryLog::encode(payload, format, args...);
+                BinaryLog::formatPayload(payload, record.message);
+            }
+            return submit(*file, std::move(record));
+        } catch (...) {
+            return false; // 예외 발생 시 실패
+        }
+    }
+
+    // 레코드를 파일 큐에 넣고 동기 모드면 기록까지 수행
+    // 타임스탬프는 호출 시점 기준, 포맷과 기록은 기록 권한을 가진 스레드에서 수행
+    bool submit(LogFile& file, PendingRecord&& record) {
+        if (asyncMode && !reserveSpace(file)) {
+            return false; // 큐가 가득 차서 버려짐
+        }
+
+        ++file.enqueued;
+        file.pending.push(std::move(record));
+
+        // 비동기 모드: writer 스레드에 맡기고 즉시 반환
+        if (asyncMode) {
+            wakeWriter();
+            return true;
+        }
+
+        drainPending(file);
+        return !(file.writeFailed.load()); // 쓰기 성공 여부 반환
+    }
+
+    // 바이너리 로그 파일이면 offset의 레코드부터 텍스트 줄로 변환해 callback에 전달하고 true 반환
+    // 텍스트 로그 파일이거나 열 수 없으면 아무것도 하지 않고 false 반환
+    template <typename Callback>
+    bool forEachBinaryLine(const std::string& filename, uint64_t offset, Callback&& callback) {
+        TimestampFormatter formatter(timestampPrecision);
+        MappedLogFile mapped(filename);
+        if (mapped.is_open()) {
+            if (!BinaryLog::isBinaryLog(mapped.data(), mapped.size())) {
+                return false;
+            }
+            if (offset < mapped.size()) {
+                BinaryLog::forEachLine(mapped.data(), mapped.size(), static_cast<size_t>(offset), formatter, callback);
+            }
+            return true;
+        }
+
+        // 매핑할 수 없으면 형식 확인에 필요한 앞부분만 읽고, 바이너리 파일이면 레코드 단위로 읽음
+        // (텍스트 파일은 호출한 쪽이 LogReader로 다시 읽으므로 여기서 전체를 읽지 않음)
+        std::ifstream file(filename, std::ios::binary);
+        char magic[BinaryLog::MagicSize];
+        if (!file.read(magic, sizeof(magic)) || !BinaryLog::isBinaryLog(magic, sizeof(magic))) {
+            return false;
+        }
+        BinaryLog::forEachLine(file, offset, formatter, callback);
+        return true;
+    }
+
+    // 관리 중인 파일이면 대기 중인 레코드를 먼저 기록하고 버퍼를 비움
+    void prepareRead(const std::string& filename) {
+        if (std::shared_ptr<LogFile> managed = findFile(filename)) {
+            flushFile(*managed);
+        }
+    }
+
+    // 시간 기준 flush가 필요한 파일이 있으면 백그라운드 스레드 시작 (filesMutex 배타 잠금 상태에서 호출)
+    void ensureBackgroundThread() {
+        if (!writerThread.joinable()) {
+            writerThread = std::thread(&LogFileManager::writerLoop, this);
+        }
+    }
+
+    // 비동기 모드: 큐가 가득 찬 경우 overflowPolicy에 따라 처리 (false면 레코드를 버림)
+    bool reserveSpace(LogFile& file) {
+        if (file.pendingCount() < asyncOptions.queueCapacity) {
+            return true;
+        }
+
+        switch (asyncOptions.overflowPolicy) {
+        case OverflowPolicy::Block: {
+            ++blockedProducers;
+            std::unique_lock<std::mutex> lock(spaceMutex);
+            spaceCondition.wait(lock, [this, &file]() {
+                return stopping.load() || file.pendingCount() < asyncOptions.queueCapacity;
+            });
+            --blockedProducers;
+            return !stopping.load();
+        }
+        case OverflowPolicy::DropNewest:
+            ++droppedCount;
+            return false;
+        case OverflowPolicy::DropOldest:
+            // 기록 권한을 잠시 얻어 가장 오래된 레코드 하나를 버림
+            // writer 스레드가 기록 중이면 곧 공간이 생기므로 그대로 추가
+            if (!file.draining.exchange(true)) {
+                PendingRecord oldest;
+                if (file.pending.pop(oldest)) {
+                    file.consumed.fetch_add(1);
+                    ++droppedCount;
+                }
+                file.draining.store(false);
+            }
+            return true;
+        }
+        return true;
+    }
+
+    // writer 스레드를 깨움 (이미 신호가 있으면 잠금 없이 반환)
+    void wakeWriter() {
+        if (!workSignal.exchange(true)) {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            wakeCondition.notify_one();
+        }
+    }
+
+    // writer 스레드: 파일별 큐를 돌아가며 batchSize 단위로 기록
+    // 동기 모드에서는 interval 정책의 시간 기준 flush만 담당
+    void writerLoop() {
+        std::vector<std::shared_ptr<LogFile>> files;
+        uint64_t snapshotVersion = UINT64_MAX;
+        std::chrono::milliseconds flushTick{0};  // 잠들어 있을 최대 시간 (가장 짧은 interval)
+
+        while (true) {
+            workSignal.store(false);
+
+            // 열린 파일 목록이 바뀐 경우에만 스냅샷 갱신
+            uint64_t version = filesVersion.load();
+            if (version != snapshotVersion) {
+                std::shared_lock<std::shared_mutex> lock(filesMutex);
+                files.clear();
+                flushTick = std::chrono::milliseconds(0);
+                for (auto& entry : logFiles) {
+                    files.push_back(entry.second);
+                    auto interval = entry.second->flushPolicy.interval;
+                    if (interval.count() > 0 && (flushTick.count() == 0 || interval < flushTick)) {
+                        flushTick = interval;
+                    }
+                }
+                snapshotVersion = version;
+            }
+
+            bool anyPending = false;
+            for (auto& file : files) {
+                if (file->hasPending() || file->flushPolicy.interval.count() > 0) {
+                    tryDrain(*file, asyncOptions.batchSize);
+                    anyPending = anyPending || file->hasPending();
+                }
+            }
+
+            // Block 정책으로 대기 중인 생산자가 있으면 깨움
+            if (blockedProducers.load() > 0) {
+                std::lock_guard<std::mutex> lock(spaceMutex);
+                spaceCondition.notify_all();
+            }
+
+            if (anyPending) {
+                continue;
+            }
+            if (stopping.load()) {
+                break;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            auto wakeUp = [this]() { return stopping.load() || workSignal.load(); };
+            if (flushTick.count() > 0) {
+                wakeCondition.wait_for(lock, flushTick, wakeUp);
+            } else {
+                wakeCondition.wait(lock, wakeUp);
+            }
+        }
+    }
+
+public:
+    // openLogFile이 반환하는 파일 핸들: 맵 조회 없이 바로 파일에 기록
+    // 파일을 닫은 뒤에는 쓰기가 실패하며, 같은 이름으로 다시 열면 새 핸들을 받아야 함
+    // 핸들은 이를 반환한 LogFileManager보다 오래 사용하면 안 됨
+    class LogHandle {
+    public:
+        LogHandle() = default;
+
+        explicit operator bool() const {
+            return file != nullptr;
+        }
+
+        // 파일 경로 (빈 핸들이면 빈 문자열)
+        std::string_view filename() const {
+            return file ? std::string_view(file->path) : std::string_view();
+        }
+
+    private:
+        friend class LogFileManager;
+
+        explicit LogHandle(std::shared_ptr<LogFile> file) : file(std::move(file)) {}
+
+        std::shared_ptr<LogFile> file;
+    };
+
+    LogFileManager() = default;
+
+    // 비동기 모드 생성자: writeLog는 큐에 레코드만 넣고 즉시 반환
+    explicit LogFileManager(const AsyncOptions& options)
+        : asyncMode(true), asyncOptions(options) {
+        if (asyncOptions.queueCapacity == 0) {
+            asyncOptions.queueCapacity = 1;
+        }
+        if (asyncOptions.batchSize == 0) {
+            asyncOptions.batchSize = 1;
+        }
+        writerThread = std::thread(&LogFileManager::writerLoop, this);
+    }
+
+    ~LogFileManager() {
+        // writer 스레드 종료 (남은 레코드는 모두 기록한 뒤 종료)
+        if (writerThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+                stopping.store(true);
+            }
+            wakeCondition.notify_all();
+            {
+                std::lock_guard<std::mutex> lock(spaceMutex);
+                spaceCondition.notify_all();
+            }
+            writerThread.join();
+        }
+
+        // 열린 파일 닫음
+        for (auto& file : logFiles) {
+            flushFile(*file.second);
+            if (file.second->stream.is_open()) {
+                file.second->stream.close();
+            }
+        }
+    }
+
+    // 이후에 여는 파일의 타임스탬프 정밀도 설정 (기본값: 초 단위)
+    void setTimestampPrecision(TimestampPrecision precision) {
+        std::unique_lock<std::shared_mutex> lock(filesMutex);
+        timestampPrecision = precision;
+    }
+
+    // 비동기 모드에서 큐가 가득 차 버려진 레코드 수
+    size_t droppedLogCount() const {
+        return droppedCount.load();
+    }
+
+    // 이름 변경에 실패해 회전하지 못한 횟수 (실패하면 기존 파일에 이어서 기록)
+    size_t rotationFailureCount() const {
+        return rotationFailures.load();
+    }
+
+    // 대기 중인 레코드를 모두 기록하고 모든 파일의 버퍼를 비움 (정상 종료 전에 호출)
+    void flushAll() {
+        std::vector<std::shared_ptr<LogFile>> files;
+        {
+            std::shared_lock<std::shared_mutex> lock(filesMutex);
+            for (auto& entry : logFiles) {
+                files.push_back(entry.second);
+            }
+        }
+        for (auto& file : files) {
+            flushFile(*file);
+        }
+    }
+
+    // 로그 파일 열기 (flushPolicy 기본값: 기록할 때마다 flush)
+    // 실패하면 빈 핸들 반환 (bool로 성공 여부 확인 가능)
+    LogHandle openLogFile(const std::string& filename, const FlushPolicy& flushPolicy = FlushPolicy::immediate()) {
+        LogFileOptions options;
+        options.flush = flushPolicy;
+        return openLogFile(filename, options);
+    }
+
+    // 로그 파일 열기 (flush / 회전 정책, 이어쓰기 여부 지정)
+    LogHandle openLogFile(const std::string& filename, const LogFileOptions& options) {
+        if (!RotationWorker::compressionSupported(options.rotation.compression)) {
+            return LogHandle(); // zlib 없이 빌드된 경우 압축 불가
+        }
+
+        std::unique_lock<std::shared_mutex> lock(filesMutex);
+        try {
+            // 이미 열려있는 파일인지 확인
+            auto existing = logFiles.find(filename);
+            if (existing != logFiles.end()) {
+                return LogHandle(existing->second); // 이미 열려있으면 기존 파일의 핸들 반환
+            }
+            
+            // 새 파일 스트림 생성 및 열기
+            auto file = std::make_shared<LogFile>(filename, timestampPrecision, options);
+            file->stream.open(filename, options.append ? std::ios::app : std::ios::trunc);
+            
+            if (!file->stream.is_open()) {
+                return LogHandle(); // 파일 열기 실패
+            }
+
+            // 이어쓰기: 기존 크기부터 회전 기준 계산
+            if (options.append) {
+                std::error_code ec;
+                auto size = std::filesystem::file_size(filename, ec);
+                file->bytesWritten = ec ? 0 : size;
+            }
+
+            // 이전 실행에서 회전된 파일이 있으면 그 다음 번호부터 사용
+            if (options.rotation.enabled()) {
+                for (auto& entry : RotationWorker::listGenerations(filename)) {
+                    file->generation = std::max(file->generation, entry.first);
+                }
+            }
+            
+            // 맵에 추가
+            logFiles[filename] = file;
+            ++filesVersion;
+
+            // 동기 모드에서도 시간 기준 flush가 지켜지도록 백그라운드 스레드 사용
+            if (options.flush.interval.count() > 0) {
+                ensureBackgroundThread();
+            }
+            return LogHandle(std::move(file));
+        } catch (...) {
+            return LogHandle(); // 예외 발생 시 실패
+        }
+    }
+
+    // 로그 쓰기 (여러 스레드에서 동시에 호출 가능)
+    // 동기 모드에서 다른 스레드가 기록 중이면 그 스레드가 이 레코드까지 기록하므로 바로 반환
+    bool writeLog(std::string_view filename, std::string_view message) {
+        std::shared_ptr<LogFile> file = findFile(filename);
+        return writeMessage(file.get(), message);
+    }
+
+    // 핸들로 로그 쓰기 (맵 조회와 잠금 없음)
+    bool writeLog(const LogHandle& handle, std::string_view message) {
+        return writeMessage(handle.file.get(), message);
+    }
+
+    // 형식 문자열과 인자로 로그 쓰기 ("{}" 자리에 인자가 순서대로 들어감)
+    // 바이너리 파일은 인자 값만 복사해 두고 포맷은 읽을 때 수행, 텍스트 파일은 바로 포맷
+    // 지원 인자: 정수, 실수, bool, char, 문자열 (std::string, std::string_view, const char*)
+    template <typename... Args>
+    bool writeRecord(std::string_view filename, Severity severity, std::string_view format, const Args&... args) {
+        std::shared_ptr<LogFile> file = findFile(filename);
+        return writeFormatted(file.get(), severity, format, args...);
+    }
+
+    // 핸들로 형식 문자열 로그 쓰기 (맵 조회와 잠금 없음)
+    template <typename... Args>
+    bool writeRecord(const LogHandle& handle, Severity severity, std::string_view format, const Args&... args) {
+        return writeFormatted(handle.file.get(), severity, format, args...);
+    }
+
+    // 로그 파일 내용 읽기
+    std::vector<std::string> readLogs(const std::string& filename) {
+        return readLogs(filename, 0, SIZE_MAX);
+    }
+
+    // 로그 파일 내용 페이지 단위 읽기 (offset줄을 건너뛰고 최대 limit줄)
+    std::vector<std::string> readLogs(const std::string& filename, size_t offset, size_t limit) {
+        std::vector<std::string> logs;
+        forEachLog(filename, [&logs](std::string_view line) {
+            logs.emplace_back(line);
+            return true;
+        }, offset, limit);
+        return logs;
+    }
+
+    // 로그 파일을 한 줄씩 callback(std::string_view)에 전달 (callback이 false를 반환하면 중단)
+    // 줄은 매핑된 메모리 또는 재사용 버퍼를 가리키므로 callback 밖에서 보관하려면 복사해야 함
+    // offset줄을 건너뛰고 최대 limit줄까지 전달하며, 전달한 줄 수 반환
+    template <typename Callback>
+    size_t forEachLog(const std::string& filename, Callback&& callback, size_t offset = 0, size_t limit = SIZE_MAX) {
+        prepareRead(filename);
+        if (limit == 0) {
+            return 0;
+        }
+
+        size_t skipped = 0;
+        size_t count = 0;
+        auto visit = [&](std::string_view line) {
+            if (skipped < offset) {
+                ++skipped;
+                return true;
+            }
+            ++count;
+            return callback(line) && count < limit;
+        };
+
+        // 바이너리 로그는 레코드를 텍스트 줄로 변환해 전달
+        if (forEachBinaryLine(filename, 0, visit)) {
+            return count;
+        }
+
+        // 메모리 매핑 + SIMD 줄 탐색 (복사 없음)
+        MappedLogFile mapped(filename);
+        if (mapped.is_open()) {
+            mapped.forEachLine(visit);
+            return count;
+        }
+
+        // 매핑할 수 없으면 스트림으로 읽음
+        LogReader reader(filename);
+        if (!reader.is_open()) {
+            return 0;
+        }
+
+        reader.skip(offset);
+        std::string_view line;
+        while (count < limit && reader.next(line)) {
+            ++count;
+            if (!callback(line)) {
+                break;
+            }
+        }
+        return count;
+    }
+
+    // 시간 범위 [from, to](초 단위, 양 끝 포함)에 있고 substring을 포함하는 줄을 callback(std::string_view)에 전달
+    // 관리 중인 파일은 희소 색인으로 시작 위치를 찾아 건너뛰고, 범위를 지나면 바로 중단
+    // 줄의 "[YYYY-MM-DD HH:MM:SS" 접두부는 해석하지 않고 같은 형식의 경계 문자열과 사전순 비교
+    // 여러 스레드가 함께 기록하면 줄 순서와 시각 순서가 약간 어긋날 수 있으므로 경계에 1초 여유를 둠
+    // 전달한 줄 수 반환
+    template <typename Callback>
+    size_t query(const std::string& filename,
+                 std::chrono::system_clock::time_point from,
+                 std::chrono::system_clock::time_point to,
+                 std::string_view substring,
+                 Callback&& callback) {
+        const std::chrono::seconds slack(1);
+        uint64_t start = 0;
+        if (std::shared_ptr<LogFile> managed = findFile(filename)) {
+            flushFile(*managed);
+            start = managed->index.offsetBefore(std::chrono::system_clock::to_time_t(from - slack));
+        }
+
+        // 경계 문자열: "[YYYY-MM-DD HH:MM:SS"
+        const size_t keyLength = 20;
+        TimestampFormatter formatter;
+        char fromKey[TimestampFormatter::MaxLength];
+        char toKey[TimestampFormatter::MaxLength];
+        char stopKey[TimestampFormatter::MaxLength];
+        formatter.format(from, fromKey);
+        formatter.format(to, toKey);
+        formatter.format(to + slack, stopKey);
+        std::string_view fromView(fromKey, keyLength);
+        std::string_view toView(toKey, keyLength);
+        std::string_view stopView(stopKey, keyLength);
+
+        size_t count = 0;
+        auto visit = [&](std::string_view line) {
+            if (line.size() < keyLength || line[0] != '[') {
+                return true; // 타임스탬프가 없는 줄은 건너뜀
+            }
+            std::string_view key = line.substr(0, keyLength);
+            if (key > stopView) {
+                return false; // 범위를 지남
+            }
+            if (key < fromView || key > toView) {
+                return true;
+            }
+            if (!substring.empty() && line.find(substring) == std::string_view::npos) {
+                return true;
+            }
+            ++count;
+            return static_cast<bool>(callback(line));
+        };
+
+        if (forEachBinaryLine(filename, start, visit)) {
+            return count;
+        }
+
+        MappedLogFile mapped(filename);
+        if (mapped.is_open()) {
+            if (start < mapped.size()) {
+                NewlineScanner::forEachLine(mapped.data() + start, mapped.size() - start, visit);
+            }
+            return count;
+        }
+
+        LogReader reader(filename);
+        if (!reader.is_open() || !reader.seek(start)) {
+            return 0;
+        }
+        std::string_view line;
+        while (reader.next(line) && visit(line)) {
+        }
+        return count;
+    }
+
+    // 시간 범위와 부분 문자열로 로그 검색 (substring이 비어 있으면 시간 범위만 적용)
+    std::vector<std::string> query(const std::string& filename,
+                                   std::chrono::system_clock::time_point from,
+                                   std::chrono::system_clock::time_point to,
+                                   std::string_view substring = {}) {
+        std::vector<std::string> logs;
+        query(filename, from, to, substring, [&logs](std::string_view line) {
+            logs.emplace_back(line);
+            return true;
+        });
+        return logs;
+    }
+
+    // 마지막 count줄 읽기: 파일 끝에서부터 거꾸로 읽어 시작 위치를 찾으므로 앞부분은 읽지 않음
+    std::vector<std::string> tailLogs(const std::string& filename, size_t count) {
+        std::vector<std::string> logs;
+        if (count == 0) {
+            return logs;
+        }
+        prepareRead(filename);
+
+        // 바이너리 로그는 레코드 길이가 제각각이라 거꾸로 읽을 수 없으므로 처음부터 디코딩하며 마지막 count줄만 유지
+        std::deque<std::string> recent;
+        if (forEachBinaryLine(filename, 0, [&](std::string_view line) {
+                if (recent.size() == count) {
+                    recent.pop_front();
+                }
+                recent.emplace_back(line);
+                return true;
+            })) {
+            logs.assign(std::make_move_iterator(recent.begin()), std::make_move_iterator(recent.end()));
+            return logs;
+        }
+
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return logs;
+        }
+
+        // 끝에서부터 블록 단위로 '\n'을 세어 마지막 count줄의 시작 위치 계산
+        uint64_t size = static_cast<uint64_t>(file.tellg());
+        uint64_t start = 0;
+        uint64_t position = size;
+        size_t newlines = 0;
+        bool skipTrailing = true;  // 파일 끝의 개행은 마지막 줄의 끝이므로 세지 않음
+        bool found = false;
+        std::vector<char> block(64 * 1024);
+        while (position > 0 && !found) {
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(block.size(), position));
+            position -= chunk;
+            file.seekg(static_cast<std::streamoff>(position));
+            file.read(block.data(), static_cast<std::streamsize>(chunk));
+            for (size_t i = chunk; i > 0; --i) {
+                if (block[i - 1] != '\n') {
+                    skipTrailing = false;
+                    continue;
+                }
+                if (skipTrailing) {
+                    skipTrailing = false;
+                    continue;
+                }
+                if (++newlines == count) {
+                    start = position + i;
+                    found = true;
+                    break;
+                }
+            }
+        }
+        file.close();
+
+        LogReader reader(filename);
+        if (!reader.is_open() || !reader.seek(start)) {
+            return logs;
+        }
+        std::string_view line;
+        while (logs.size() < count && reader.next(line)) {
+            logs.emplace_back(line);
+        }
+        return logs;
+    }
+
+    // 로그 파일 닫기
+    bool closeLogFile(std::string_view filename) {
+        std::shared_ptr<LogFile> file;
+        {
+            std::unique_lock<std::shared_mutex> lock(filesMutex);
+            auto it = logFiles.find(filename);
+            if (it == logFiles.end()) {
+                return false; // 파일이 맵에 없음
+            }
+            file = std::move(it->second);
+            logFiles.erase(it); // 맵에서 제거
+            ++filesVersion;
+        }
+
+        // 닫기 전에 대기 중인 레코드를 먼저 기록 (이 파일의 핸들로 쓰기도 이후 실패)
+        file->closed.store(true);
+        flushFile(*file);
+
+        // writer 스레드가 기록 중일 수 있으므로 기록 권한을 얻은 뒤 닫음
+        while (file->draining.exchange(true)) {
+            std::this_thread::yield();
+        }
+        if (file->stream.is_open()) {
+            file->stream.close();
+        }
+        file->draining.store(false);
+        return true;
+    }
+};
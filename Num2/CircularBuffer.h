@@ -0,0 +1,1379 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <span>
+#include <memory>
+#include <type_traits>
+#include <cstring>
+#include <string>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// GCC / Clang 벡터 확장이 있으면 리덕션을 SIMD로 수행 (x86은 SSE2 / AVX2, ARM은 NEON으로 컴파일됨)
+#if defined(__GNUC__) || defined(__clang__)
+#define CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+#if defined(__x86_64__) || defined(__i386__)
+#define CIRCULARBUFFER_HAVE_AVX2
+#endif
+#endif
+
+// 2의 거듭제곱으로 올림 (나머지 연산 대신 비트 마스크를 쓰기 위해 사용)
+inline size_t round_up_to_power_of_two(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+#ifdef CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+// Lanes개의 U로 이루어진 벡터 타입 (벡터 확장 속성은 별칭 템플릿에 붙일 수 없으므로 typedef로 정의)
+template <typename U, size_t Lanes>
+struct SimdVector {
+    typedef U type __attribute__((vector_size(Lanes * sizeof(U))));
+};
+#endif
+
+// 산술 타입 배열의 합계 / 최소최대 / 내적 / 히스토그램 (CircularBuffer의 연속 구간 두 개에 사용)
+// 32바이트 벡터 단위로 처리하며 x86에서는 실행 시 한 번 AVX2 지원 여부를 확인해 구현을 고름
+template <typename T>
+class VectorReductions {
+    static_assert(std::is_arithmetic_v<T>, "VectorReductions는 산술 타입만 지원합니다");
+
+public:
+    // 합계 / 내적 타입: 실수는 T, 정수는 64비트 정수 (int16 센서 값 등의 오버플로 방지)
+    using accumulator_type = std::conditional_t<std::is_floating_point_v<T>, T,
+                                                std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+    static accumulator_type sum(const T* data, size_t count) {
+        return select().sum(data, count);
+    }
+
+    // count > 0이어야 함
+    static void min_max(const T* data, size_t count, T& minimum, T& maximum) {
+        select().min_max(data, count, minimum, maximum);
+    }
+
+    static accumulator_type dot(const T* left, const T* right, size_t count) {
+        return select().dot(left, right, count);
+    }
+
+    // [lower, upper) 구간을 bins개로 나눈 히스토그램을 counts[0, bins)에 더함 (구간 밖의 값은 무시)
+    static void histogram(const T* data, size_t count, double lower, double upper, size_t bins, size_t* counts) {
+        select().histogram(data, count, lower, upper, bins, counts);
+    }
+
+    // 사용 중인 구현 이름 ("avx2", "sse2", "neon", "vector", "scalar")
+    static const char* implementation() {
+        return select().name;
+    }
+
+private:
+    struct Kernels {
+        accumulator_type (*sum)(const T*, size_t);
+        void (*min_max)(const T*, size_t, T&, T&);
+        accumulator_type (*dot)(const T*, const T*, size_t);
+        void (*histogram)(const T*, size_t, double, double, size_t, size_t*);
+        const char* name;
+    };
+
+    static const Kernels& select() {
+#ifdef CIRCULARBUFFER_HAVE_AVX2
+        static const Kernels kernels = __builtin_cpu_supports("avx2")
+            ? Kernels{&sum_avx2, &min_max_avx2, &dot_avx2, &histogram_avx2, "avx2"}
+            : Kernels{&sum_default, &min_max_default, &dot_default, &histogram_default, "sse2"};
+#elif defined(CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS) && defined(__ARM_NEON)
+        static const Kernels kernels{&sum_default, &min_max_default, &dot_default, &histogram_default, "neon"};
+#elif defined(CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS)
+        static const Kernels kernels{&sum_default, &min_max_default, &dot_default, &histogram_default, "vector"};
+#else
+        static const Kernels kernels{&sum_default, &min_max_default, &dot_default, &histogram_default, "scalar"};
+#endif
+        return kernels;
+    }
+
+    // 16비트 이하 정수의 합계는 두 배 너비(8비트 -> 16비트, 16비트 -> 32비트) 벡터로 블록 단위 누적 후 64비트로 합침
+    // (64비트로 바로 넓히는 것보다 한 번에 처리하는 요소가 많음)
+    // 블록마다 누적 벡터의 각 칸에 8비트는 최대 255개, 16비트는 최대 65535개를 더하므로 넘치지 않음
+    static constexpr bool narrow_integer = std::is_integral_v<T> && sizeof(T) <= 2;
+    using partial_type = std::conditional_t<
+        narrow_integer,
+        std::conditional_t<sizeof(T) == 1,
+                           std::conditional_t<std::is_signed_v<T>, int16_t, uint16_t>,
+                           std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t>>,
+        accumulator_type>;
+    static constexpr size_t block_iterations = !narrow_integer ? SIZE_MAX : (sizeof(T) == 1 ? 255 : 65535);
+
+#ifdef CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+#define CIRCULARBUFFER_INLINE [[gnu::always_inline]] inline
+    // 계산에 쓰는 벡터는 모두 32바이트(AVX2 레지스터 하나, SSE2 / NEON 레지스터 두 개)
+    // 더 넓은 타입으로 변환할 때는 변환 후 32바이트가 되도록 그만큼 적은 요소를 읽음
+    // (32바이트보다 큰 벡터는 레지스터에 담기지 않아 스택으로 넘쳐 느려짐)
+    static constexpr size_t lanes = 32 / sizeof(T);
+    static constexpr size_t sum_lanes = 32 / sizeof(partial_type);
+    static constexpr size_t dot_lanes = 32 / sizeof(accumulator_type);
+    static constexpr size_t histogram_lanes = 32 / sizeof(double);
+
+    using vector_type = typename SimdVector<T, lanes>::type;
+    using partial_vector = typename SimdVector<partial_type, sum_lanes>::type;
+    using accumulator_vector = typename SimdVector<accumulator_type, dot_lanes>::type;
+    using double_vector = typename SimdVector<double, histogram_lanes>::type;
+
+    // data에서 Lanes개를 정렬되지 않은 읽기로 가져와 result의 요소 타입으로 변환
+    // (벡터를 값으로 반환하면 함수 경계에서 ABI 경고가 나므로 참조로 돌려줌)
+    template <size_t Lanes, typename Vector>
+    CIRCULARBUFFER_INLINE static void load(const T* data, Vector& result) {
+        typename SimdVector<T, Lanes>::type value;
+        std::memcpy(&value, data, sizeof(value));
+        result = __builtin_convertvector(value, Vector);
+    }
+#else
+#define CIRCULARBUFFER_INLINE inline
+#endif
+
+    // 덧셈 지연을 숨기기 위해 누적 벡터 4개를 번갈아 사용
+    CIRCULARBUFFER_INLINE static accumulator_type sum_kernel(const T* data, size_t count) {
+        accumulator_type total = 0;
+        size_t i = 0;
+#ifdef CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+        constexpr size_t step = 4 * sum_lanes;
+        while (i + step <= count) {
+            partial_vector acc0{}, acc1{}, acc2{}, acc3{};
+            for (size_t iteration = 0; iteration < block_iterations && i + step <= count; ++iteration, i += step) {
+                partial_vector value0, value1, value2, value3;
+                load<sum_lanes>(data + i, value0);
+                load<sum_lanes>(data + i + sum_lanes, value1);
+                load<sum_lanes>(data + i + 2 * sum_lanes, value2);
+                load<sum_lanes>(data + i + 3 * sum_lanes, value3);
+                acc0 += value0;
+                acc1 += value1;
+                acc2 += value2;
+                acc3 += value3;
+            }
+            // 누적 벡터끼리 더하면 부분합 타입을 넘칠 수 있으므로 칸마다 누적 타입으로 바꿔 합침
+            for (size_t lane = 0; lane < sum_lanes; ++lane) {
+                total += static_cast<accumulator_type>(acc0[lane]) + static_cast<accumulator_type>(acc1[lane]) +
+                         static_cast<accumulator_type>(acc2[lane]) + static_cast<accumulator_type>(acc3[lane]);
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            total += data[i];
+        }
+        return total;
+    }
+
+    CIRCULARBUFFER_INLINE static void min_max_kernel(const T* data, size_t count, T& minimum, T& maximum) {
+        T low = data[0];
+        T high = data[0];
+        size_t i = 0;
+#ifdef CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+        if (count >= lanes) {
+            // 비교 지연을 숨기기 위해 최소 / 최대 벡터를 2개씩 사용
+            vector_type lows;
+            load<lanes>(data, lows);
+            vector_type highs = lows;
+            vector_type lows2 = lows;
+            vector_type highs2 = lows;
+            for (i = lanes; i + 2 * lanes <= count; i += 2 * lanes) {
+                vector_type value, value2;
+                load<lanes>(data + i, value);
+                load<lanes>(data + i + lanes, value2);
+                lows = value < lows ? value : lows;
+                highs = value > highs ? value : highs;
+                lows2 = value2 < lows2 ? value2 : lows2;
+                highs2 = value2 > highs2 ? value2 : highs2;
+            }
+            for (; i + lanes <= count; i += lanes) {
+                vector_type value;
+                load<lanes>(data + i, value);
+                lows = value < lows ? value : lows;
+                highs = value > highs ? value : highs;
+            }
+            lows = lows2 < lows ? lows2 : lows;
+            highs = highs2 > highs ? highs2 : highs;
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                low = lows[lane] < low ? lows[lane] : low;
+                high = highs[lane] > high ? highs[lane] : high;
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            low = data[i] < low ? data[i] : low;
+            high = data[i] > high ? data[i] : high;
+        }
+        minimum = low;
+        maximum = high;
+    }
+
+    CIRCULARBUFFER_INLINE static accumulator_type dot_kernel(const T* left, const T* right, size_t count) {
+        accumulator_type total = 0;
+        size_t i = 0;
+#ifdef CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+        accumulator_vector acc0{}, acc1{};
+        for (; i + 2 * dot_lanes <= count; i += 2 * dot_lanes) {
+            accumulator_vector left0, right0, left1, right1;
+            load<dot_lanes>(left + i, left0);
+            load<dot_lanes>(right + i, right0);
+            load<dot_lanes>(left + i + dot_lanes, left1);
+            load<dot_lanes>(right + i + dot_lanes, right1);
+            acc0 += left0 * right0;
+            acc1 += left1 * right1;
+        }
+        acc0 += acc1;
+        for (size_t lane = 0; lane < dot_lanes; ++lane) {
+            total += acc0[lane];
+        }
+#endif
+        for (; i < count; ++i) {
+            total += static_cast<accumulator_type>(left[i]) * static_cast<accumulator_type>(right[i]);
+        }
+        return total;
+    }
+
+    // 칸 번호 계산은 벡터로, 개수 증가는 요소마다 수행
+    CIRCULARBUFFER_INLINE static void histogram_kernel(const T* data, size_t count, double lower, double upper,
+                                                       size_t bins, size_t* counts) {
+        const double scale = static_cast<double>(bins) / (upper - lower);
+        auto add = [&](double value, double scaled) {
+            if (value >= lower && value < upper) {
+                size_t bin = static_cast<size_t>(scaled);
+                counts[bin < bins ? bin : bins - 1] += 1; // 반올림으로 upper 바로 아래 값이 bins가 되는 경우
+            }
+        };
+
+        size_t i = 0;
+#ifdef CIRCULARBUFFER_HAVE_VECTOR_EXTENSIONS
+        for (; i + histogram_lanes <= count; i += histogram_lanes) {
+            double_vector values;
+            load<histogram_lanes>(data + i, values);
+            double_vector scaled = (values - lower) * scale;
+            for (size_t lane = 0; lane < histogram_lanes; ++lane) {
+                add(values[lane], scaled[lane]);
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            double value = static_cast<double>(data[i]);
+            add(value, (value - lower) * scale);
+        }
+    }
+#undef CIRCULARBUFFER_INLINE
+
+    static accumulator_type sum_default(const T* data, size_t count) {
+        return sum_kernel(data, count);
+    }
+
+    static void min_max_default(const T* data, size_t count, T& minimum, T& maximum) {
+        min_max_kernel(data, count, minimum, maximum);
+    }
+
+    static accumulator_type dot_default(const T* left, const T* right, size_t count) {
+        return dot_kernel(left, right, count);
+    }
+
+    static void histogram_default(const T* data, size_t count, double lower, double upper, size_t bins, size_t* counts) {
+        histogram_kernel(data, count, lower, upper, bins, counts);
+    }
+
+#ifdef CIRCULARBUFFER_HAVE_AVX2
+    // 같은 커널을 AVX2로 다시 컴파일한 버전
+    __attribute__((target("avx2"))) static accumulator_type sum_avx2(const T* data, size_t count) {
+        return sum_kernel(data, count);
+    }
+
+    __attribute__((target("avx2"))) static void min_max_avx2(const T* data, size_t count, T& minimum, T& maximum) {
+        min_max_kernel(data, count, minimum, maximum);
+    }
+
+    __attribute__((target("avx2"))) static accumulator_type dot_avx2(const T* left, const T* right, size_t count) {
+        return dot_kernel(left, right, count);
+    }
+
+    __attribute__((target("avx2"))) static void histogram_avx2(const T* data, size_t count, double lower, double upper,
+                                                              size_t bins, size_t* counts) {
+        histogram_kernel(data, count, lower, upper, bins, counts);
+    }
+#endif
+};
+
+// PowerOfTwo = true이면 용량을 2의 거듭제곱으로 올리고 위치 계산에 나머지 연산 대신 비트 마스크 사용
+// 저장 공간은 생성하지 않은 메모리로 할당하고, 요소는 넣을 때 생성 / 제거하거나 덮어쓸 때 소멸
+template <typename T, bool PowerOfTwo = false>
+class CircularBuffer {
+private:
+    T* buffer = nullptr;  // max_size개 크기의 생성되지 않은 메모리 ([head, tail) 칸만 생성된 상태)
+    uint64_t head = 0;  // 첫 번째 요소의 누적 위치
+    uint64_t tail = 0;  // 마지막 요소 다음의 누적 위치 (tail - head = 요소 개수)
+    size_t max_size;  // 버퍼 최대 크기
+    size_t mask;      // PowerOfTwo일 때 max_size - 1
+
+    // 누적 위치를 버퍼 칸 번호로 변환
+    size_t slot(uint64_t position) const {
+        if constexpr (PowerOfTwo) {
+            return static_cast<size_t>(position & mask);
+        } else {
+            return static_cast<size_t>(position % max_size);
+        }
+    }
+
+    // 맨 앞 요소 count개 소멸 (개수는 호출하는 쪽에서 확인)
+    void destroy_front(size_t count) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; ++i) {
+                std::destroy_at(buffer + slot(head + i));
+            }
+        }
+        head += count;
+    }
+
+public:
+    // 생성자
+    CircularBuffer(size_t capacity)
+        : max_size(PowerOfTwo ? round_up_to_power_of_two(capacity) : capacity), mask(max_size - 1) {
+        if (capacity == 0) {
+            throw std::invalid_argument("용량은 0보다 커야 합니다");
+        }
+        buffer = std::allocator<T>().allocate(max_size);
+    }
+
+    // 복사 생성자: 같은 용량으로 요소를 오래된 순서대로 복사
+    CircularBuffer(const CircularBuffer& other) : CircularBuffer(other.max_size) {
+        auto [first, second] = other.as_spans();
+        push_back(first);
+        push_back(second);
+    }
+
+    // 이동 생성자: 저장 공간을 넘겨받음 (이동된 객체는 소멸시키거나 다시 대입하는 것만 가능)
+    CircularBuffer(CircularBuffer&& other) noexcept
+        : buffer(std::exchange(other.buffer, nullptr)),
+          head(std::exchange(other.head, 0)),
+          tail(std::exchange(other.tail, 0)),
+          max_size(other.max_size),
+          mask(other.mask) {}
+
+    // 복사 / 이동 대입 (복사 후 교환)
+    CircularBuffer& operator=(CircularBuffer other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~CircularBuffer() {
+        if (buffer != nullptr) {
+            clear();
+            std::allocator<T>().deallocate(buffer, max_size);
+        }
+    }
+
+    void swap(CircularBuffer& other) noexcept {
+        std::swap(buffer, other.buffer);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(max_size, other.max_size);
+        std::swap(mask, other.mask);
+    }
+
+    // 요소를 칸에서 바로 생성해 추가 (가득 찬 경우 가장 오래된 요소를 소멸시키고 그 칸에 생성)
+    // 생성 중 예외가 나면 덮어쓸 예정이던 가장 오래된 요소는 이미 제거된 상태
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (tail - head == max_size) {
+            destroy_front(1);
+        }
+        T* item = std::construct_at(buffer + slot(tail), std::forward<Args>(args)...);
+        ++tail;
+        return *item;
+    }
+
+    // 요소 추가
+    void push_back(const T& item) {
+        emplace_back(item);
+    }
+
+    // 요소 이동 추가
+    void push_back(T&& item) {
+        emplace_back(std::move(item));
+    }
+
+    // 여러 요소 한 번에 추가 (가득 차면 가장 오래된 요소부터 덮어씀)
+    // 버퍼보다 많이 넣으면 마지막 capacity()개만 남음
+    void push_back(std::span<const T> items) {
+        // 어차피 덮어써질 앞부분은 복사하지 않음
+        if (items.size() > max_size) {
+            destroy_front(size());
+            tail += items.size() - max_size;
+            head = tail;
+            items = items.last(max_size);
+        } else if (size() + items.size() > max_size) {
+            destroy_front(size() + items.size() - max_size);
+        }
+
+        // 버퍼 끝에서 잘리면 두 번에 나눠 생성 (단순 복사 가능한 타입은 memmove)
+        // 두 번째 구간에서 예외가 나도 첫 번째 구간은 버퍼에 남도록 구간마다 tail을 갱신
+        size_t start = slot(tail);
+        size_t first = std::min(items.size(), max_size - start);
+        std::uninitialized_copy(items.begin(), items.begin() + first, buffer + start);
+        tail += first;
+        std::uninitialized_copy(items.begin() + first, items.end(), buffer);
+        tail += items.size() - first;
+    }
+
+    // 맨 앞 요소 제거
+    void pop_front() {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        
+        // 요소를 소멸시키고 head 위치 업데이트
+        destroy_front(1);
+    }
+
+    // 맨 뒤 요소 제거
+    void pop_back() {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        --tail;
+        std::destroy_at(buffer + slot(tail));
+    }
+
+    // 맨 앞 요소 count개 제거
+    void pop_front(size_t count) {
+        if (count > size()) {
+            throw std::runtime_error("버퍼에 요소가 부족합니다");
+        }
+        destroy_front(count);
+    }
+
+    // 모든 요소 제거
+    void clear() {
+        destroy_front(size());
+    }
+
+    // 오래된 순서로 최대 count개를 destination에 복사하고 복사한 개수 반환 (버퍼에서 제거하지 않음)
+    size_t copy_out(T* destination, size_t count) const {
+        count = std::min(count, size());
+        auto [first, second] = as_spans();
+        size_t from_first = std::min(count, first.size());
+        std::copy(first.begin(), first.begin() + from_first, destination);
+        std::copy(second.begin(), second.begin() + (count - from_first), destination + from_first);
+        return count;
+    }
+
+    // 내용을 오래된 순서의 연속 구간 두 개로 반환 (순환하지 않았으면 두 번째 구간은 비어 있음)
+    // 버퍼를 수정하면 구간이 무효화됨
+    std::pair<std::span<T>, std::span<T>> as_spans() {
+        size_t start = slot(head);
+        size_t first = std::min(size(), max_size - start);
+        return {std::span<T>(buffer + start, first), std::span<T>(buffer, size() - first)};
+    }
+
+    std::pair<std::span<const T>, std::span<const T>> as_spans() const {
+        size_t start = slot(head);
+        size_t first = std::min(size(), max_size - start);
+        return {std::span<const T>(buffer + start, first), std::span<const T>(buffer, size() - first)};
+    }
+
+    // 합계 (산술 타입만, 정수는 64비트 정수로 누적)
+    auto sum() const requires std::is_arithmetic_v<T> {
+        auto [first, second] = as_spans();
+        return VectorReductions<T>::sum(first.data(), first.size()) + VectorReductions<T>::sum(second.data(), second.size());
+    }
+
+    // 최솟값 (산술 타입만)
+    T min() const requires std::is_arithmetic_v<T> {
+        T minimum, maximum;
+        min_max(minimum, maximum);
+        return minimum;
+    }
+
+    // 최댓값 (산술 타입만)
+    T max() const requires std::is_arithmetic_v<T> {
+        T minimum, maximum;
+        min_max(minimum, maximum);
+        return maximum;
+    }
+
+    // 최솟값과 최댓값을 한 번에 계산 (산술 타입만)
+    void min_max(T& minimum, T& maximum) const requires std::is_arithmetic_v<T> {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        auto [first, second] = as_spans();
+        VectorReductions<T>::min_max(first.data(), first.size(), minimum, maximum);
+        if (!second.empty()) {
+            T low, high;
+            VectorReductions<T>::min_max(second.data(), second.size(), low, high);
+            minimum = low < minimum ? low : minimum;
+            maximum = high > maximum ? high : maximum;
+        }
+    }
+
+    // 오래된 순서의 내용과 weights의 내적 (weights 크기는 size()와 같아야 함, 산술 타입만)
+    auto dot(std::span<const T> weights) const requires std::is_arithmetic_v<T> {
+        if (weights.size() != size()) {
+            throw std::invalid_argument("가중치 개수가 요소 개수와 다릅니다");
+        }
+        auto [first, second] = as_spans();
+        return VectorReductions<T>::dot(first.data(), weights.data(), first.size()) +
+               VectorReductions<T>::dot(second.data(), weights.data() + first.size(), second.size());
+    }
+
+    // [lower, upper) 구간을 bins개로 나눈 히스토그램 (구간 밖의 값은 세지 않음, 산술 타입만)
+    std::vector<size_t> histogram(T lower, T upper, size_t bins) const requires std::is_arithmetic_v<T> {
+        if (bins == 0 || !(lower < upper)) {
+            throw std::invalid_argument("히스토그램 구간이 올바르지 않습니다");
+        }
+        std::vector<size_t> counts(bins, 0);
+        auto [first, second] = as_spans();
+        VectorReductions<T>::histogram(first.data(), first.size(), lower, upper, bins, counts.data());
+        VectorReductions<T>::histogram(second.data(), second.size(), lower, upper, bins, counts.data());
+        return counts;
+    }
+
+    // 맨 앞 요소 반환
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return buffer[slot(head)];
+    }
+
+    // 맨 뒤 요소 반환
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return buffer[slot(tail - 1)];
+    }
+
+    // const 버전 front()
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return buffer[slot(head)];
+    }
+
+    // const 버전 back()
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return buffer[slot(tail - 1)];
+    }
+
+    // 버퍼 크기 반환
+    size_t size() const {
+        return static_cast<size_t>(tail - head);
+    }
+
+    // 버퍼 용량 반환
+    size_t capacity() const {
+        return max_size;
+    }
+
+    // 버퍼가 비어있는지 확인
+    bool empty() const {
+        return head == tail;
+    }
+
+    // 반복자 구현을 위한 내부 클래스
+    class iterator {
+    private:
+        CircularBuffer* buffer_ptr;
+        uint64_t position;  // 누적 위치 (칸 번호는 역참조할 때 계산)
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator(CircularBuffer* buf, uint64_t pos)
+            : buffer_ptr(buf), position(pos) {}
+
+        reference operator*() {
+            return buffer_ptr->buffer[buffer_ptr->slot(position)];
+        }
+
+        pointer operator->() {
+            return &(buffer_ptr->buffer[buffer_ptr->slot(position)]);
+        }
+
+        iterator& operator++() {
+            ++position;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const iterator& other) const {
+            return position == other.position;
+        }
+
+        bool operator!=(const iterator& other) const {
+            return position != other.position;
+        }
+    };
+
+    // begin 반복자
+    iterator begin() {
+        return iterator(this, head);
+    }
+
+    // end 반복자
+    iterator end() {
+        return iterator(this, tail);
+    }
+};
+
+// 구간 통계를 요소를 넣고 뺄 때마다 갱신하는 CircularBuffer 래퍼 (모든 통계 조회가 O(1))
+// - 합계: Kahan 보정 합
+// - 평균 / 분산: Welford 방식 (요소를 뺄 때는 역연산)
+// - 최소 / 최대: 단조 덱 (앞이 현재 구간의 최솟값 / 최댓값)
+// 빼기 연산의 반올림 오차가 쌓이지 않도록 capacity()번 뺄 때마다 합계와 분산을 내용에서 다시 계산 (분할 상환 O(1))
+template <typename T, bool PowerOfTwo = false>
+class StatisticsBuffer {
+    static_assert(std::is_arithmetic_v<T>, "StatisticsBuffer는 산술 타입만 지원합니다");
+
+private:
+    struct Entry {
+        uint64_t position;  // 넣은 순서 (구간을 벗어났는지 판단)
+        T value;
+    };
+
+    CircularBuffer<T, PowerOfTwo> values;
+    CircularBuffer<Entry, PowerOfTwo> minimums;  // 값이 증가하는 순서
+    CircularBuffer<Entry, PowerOfTwo> maximums;  // 값이 감소하는 순서
+    uint64_t pushed = 0;   // 지금까지 넣은 요소 수 (다음 요소의 위치)
+    size_t removals = 0;   // 마지막 재계산 이후 뺀 요소 수
+
+    double kahan_sum = 0.0;
+    double compensation = 0.0;
+    double running_mean = 0.0;
+    double squared_deviations = 0.0;  // 평균과의 차이 제곱의 합 (Welford M2)
+
+    void add_to_sum(double value) {
+        double adjusted = value - compensation;
+        double total = kahan_sum + adjusted;
+        compensation = (total - kahan_sum) - adjusted;
+        kahan_sum = total;
+    }
+
+    // 요소가 들어온 뒤 호출 (values.size()는 이미 증가한 상태)
+    void add_statistics(T item) {
+        double value = static_cast<double>(item);
+        add_to_sum(value);
+        double delta = value - running_mean;
+        running_mean += delta / static_cast<double>(values.size());
+        squared_deviations += delta * (value - running_mean);
+    }
+
+    // 요소가 빠진 뒤 호출 (values.size()는 이미 감소한 상태)
+    void remove_statistics(T item) {
+        if (values.empty()) {
+            reset_statistics();
+            return;
+        }
+        double value = static_cast<double>(item);
+        add_to_sum(-value);
+        double delta = value - running_mean;
+        running_mean -= delta / static_cast<double>(values.size());
+        squared_deviations = std::max(0.0, squared_deviations - delta * (value - running_mean));
+
+        if (++removals >= values.capacity()) {
+            recompute();
+        }
+    }
+
+    void reset_statistics() {
+        kahan_sum = compensation = running_mean = squared_deviations = 0.0;
+        removals = 0;
+    }
+
+    // 현재 내용으로 합계, 평균, 분산을 다시 계산
+    void recompute() {
+        reset_statistics();
+        auto [first, second] = values.as_spans();
+        for (auto segment : {first, second}) {
+            for (T item : segment) {
+                add_to_sum(static_cast<double>(item));
+            }
+        }
+        running_mean = kahan_sum / static_cast<double>(values.size());
+        for (auto segment : {first, second}) {
+            for (T item : segment) {
+                double delta = static_cast<double>(item) - running_mean;
+                squared_deviations += delta * delta;
+            }
+        }
+    }
+
+    // 구간의 첫 위치보다 앞선 단조 덱 항목 제거
+    void expire(uint64_t oldest) {
+        while (!minimums.empty() && minimums.front().position < oldest) {
+            minimums.pop_front();
+        }
+        while (!maximums.empty() && maximums.front().position < oldest) {
+            maximums.pop_front();
+        }
+    }
+
+public:
+    // 생성자
+    StatisticsBuffer(size_t capacity)
+        : values(capacity), minimums(capacity), maximums(capacity) {}
+
+    // 요소 추가 (가득 찬 경우 가장 오래된 요소를 덮어쓰고 통계에서 뺌)
+    void push_back(T item) {
+        if (values.size() == values.capacity()) {
+            T oldest = values.front();
+            values.pop_front();
+            remove_statistics(oldest);
+        }
+
+        uint64_t position = pushed++;
+        values.push_back(item);
+        add_statistics(item);
+
+        // 덱에 남는 항목은 항상 구간 안에 있으므로 덱 크기는 capacity()를 넘지 않음
+        expire(pushed - values.size());
+        while (!minimums.empty() && !(minimums.back().value < item)) {
+            minimums.pop_back();
+        }
+        minimums.push_back(Entry{position, item});
+        while (!maximums.empty() && !(item < maximums.back().value)) {
+            maximums.pop_back();
+        }
+        maximums.push_back(Entry{position, item});
+    }
+
+    // 맨 앞 요소 제거
+    void pop_front() {
+        T oldest = values.front();  // 비어 있으면 예외
+        values.pop_front();
+        remove_statistics(oldest);
+        expire(pushed - values.size());
+    }
+
+    // 구간 합계
+    double sum() const {
+        return kahan_sum;
+    }
+
+    // 구간 평균
+    double mean() const {
+        if (values.empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return running_mean;
+    }
+
+    // 모분산 (요소가 없으면 0)
+    double variance() const {
+        return values.empty() ? 0.0 : squared_deviations / static_cast<double>(values.size());
+    }
+
+    // 표본분산 (요소가 2개 미만이면 0)
+    double sample_variance() const {
+        return values.size() < 2 ? 0.0 : squared_deviations / static_cast<double>(values.size() - 1);
+    }
+
+    // 구간 최솟값
+    T min() const {
+        if (values.empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return minimums.front().value;
+    }
+
+    // 구간 최댓값
+    T max() const {
+        if (values.empty()) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return maximums.front().value;
+    }
+
+    const T& front() const {
+        return values.front();
+    }
+
+    const T& back() const {
+        return values.back();
+    }
+
+    size_t size() const {
+        return values.size();
+    }
+
+    size_t capacity() const {
+        return values.capacity();
+    }
+
+    bool empty() const {
+        return values.empty();
+    }
+
+    // 내용을 오래된 순서의 연속 구간 두 개로 반환
+    std::pair<std::span<const T>, std::span<const T>> as_spans() const {
+        return values.as_spans();
+    }
+};
+
+// 여러 스레드가 함께 쓰는 인덱스를 서로 다른 캐시 라인에 두기 위한 크기
+inline constexpr size_t cache_line_size = 64;
+
+// 버퍼가 가득 찼을 때 동작
+enum class OverflowMode {
+    Reject,          // 새 요소를 넣지 않고 실패 반환
+    OverwriteOldest  // 가장 오래된 요소를 버리고 넣음 (CircularBuffer와 같은 동작)
+};
+
+// 생산자 스레드 1개, 소비자 스레드 1개용 wait-free 순환 버퍼
+// try_push는 생산자 스레드에서만, try_pop은 소비자 스레드에서만 호출해야 함
+// 가장 오래된 요소를 덮어쓰려면 생산자가 소비자 위치를 옮겨야 하므로 SPSC에서는 Reject만 지원
+// (덮어쓰기가 필요하면 MpmcCircularBuffer의 OverwriteOldest 사용)
+template <typename T>
+class SpscCircularBuffer {
+private:
+    std::vector<T> buffer;  // 가득 참과 비어 있음을 구분하기 위해 한 칸 더 사용
+    size_t max_size;
+
+    // 생산자 전용 캐시 라인: tail은 생산자만 쓰고, cached_head는 마지막으로 읽은 head
+    alignas(cache_line_size) std::atomic<size_t> tail{0};
+    size_t cached_head = 0;
+
+    // 소비자 전용 캐시 라인: head는 소비자만 쓰고, cached_tail은 마지막으로 읽은 tail
+    alignas(cache_line_size) std::atomic<size_t> head{0};
+    size_t cached_tail = 0;
+
+    size_t next(size_t index) const {
+        return index + 1 == buffer.size() ? 0 : index + 1;
+    }
+
+    template <typename U>
+    bool push_impl(U&& item) {
+        size_t current = tail.load(std::memory_order_relaxed);
+        size_t following = next(current);
+        if (following == cached_head) {
+            // 캐시된 head로는 가득 찬 것처럼 보일 때만 소비자의 head를 다시 읽음
+            cached_head = head.load(std::memory_order_acquire);
+            if (following == cached_head) {
+                return false;
+            }
+        }
+        buffer[current] = std::forward<U>(item);
+        tail.store(following, std::memory_order_release);
+        return true;
+    }
+
+public:
+    // 생성자
+    SpscCircularBuffer(size_t capacity) : max_size(capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("용량은 0보다 커야 합니다");
+        }
+        buffer.resize(capacity + 1);
+    }
+
+    SpscCircularBuffer(const SpscCircularBuffer&) = delete;
+    SpscCircularBuffer& operator=(const SpscCircularBuffer&) = delete;
+
+    // 요소 추가 (가득 차 있으면 false)
+    bool try_push(const T& item) {
+        return push_impl(item);
+    }
+
+    bool try_push(T&& item) {
+        return push_impl(std::move(item));
+    }
+
+    // 맨 앞 요소를 꺼내 item에 저장 (비어 있으면 false)
+    bool try_pop(T& item) {
+        size_t current = head.load(std::memory_order_relaxed);
+        if (current == cached_tail) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (current == cached_tail) {
+                return false;
+            }
+        }
+        item = std::move(buffer[current]);
+        head.store(next(current), std::memory_order_release);
+        return true;
+    }
+
+    // 현재 요소 개수 (다른 스레드가 사용 중이면 근사값)
+    size_t size() const {
+        size_t current_tail = tail.load(std::memory_order_acquire);
+        size_t current_head = head.load(std::memory_order_acquire);
+        if (current_tail >= current_head) {
+            return current_tail - current_head;
+        }
+        return buffer.size() - (current_head - current_tail);
+    }
+
+    // 버퍼 용량 반환
+    size_t capacity() const {
+        return max_size;
+    }
+
+    // 버퍼가 비어있는지 확인 (다른 스레드가 사용 중이면 근사값)
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
+
+// 여러 생산자 / 여러 소비자용 lock-free 순환 버퍼 (칸마다 순번을 두는 방식)
+// 칸의 순번이 위치와 같으면 쓸 수 있고, 위치 + 1이면 읽을 수 있음
+// 생산자와 소비자는 각자의 위치를 CAS로 하나씩 차지한 뒤 그 칸만 사용하므로 서로 잠그지 않음
+template <typename T>
+class MpmcCircularBuffer {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T data{};
+    };
+
+    std::vector<Cell> buffer;
+    size_t max_size;
+    OverflowMode overflow_mode;
+
+    alignas(cache_line_size) std::atomic<size_t> tail{0};  // 다음에 쓸 위치 (누적)
+    alignas(cache_line_size) std::atomic<size_t> head{0};  // 다음에 읽을 위치 (누적)
+    alignas(cache_line_size) std::atomic<size_t> overwritten{0};
+
+    template <typename U>
+    bool push_impl(U&& item) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = buffer[position % max_size];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                // 쓸 수 있는 칸: 위치를 차지하면 기록
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.data = std::forward<U>(item);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                // 가득 참: 덮어쓰기 모드면 가장 오래된 요소를 버리고 다시 시도
+                if (overflow_mode == OverflowMode::Reject) {
+                    return false;
+                }
+                T discarded;
+                if (try_pop(discarded)) {
+                    overwritten.fetch_add(1, std::memory_order_relaxed);
+                }
+                position = tail.load(std::memory_order_relaxed);
+            } else {
+                // 다른 생산자가 먼저 차지함
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    // 생성자
+    MpmcCircularBuffer(size_t capacity, OverflowMode mode = OverflowMode::Reject)
+        : buffer(capacity), max_size(capacity), overflow_mode(mode) {
+        if (capacity == 0) {
+            throw std::invalid_argument("용량은 0보다 커야 합니다");
+        }
+        for (size_t i = 0; i < capacity; ++i) {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcCircularBuffer(const MpmcCircularBuffer&) = delete;
+    MpmcCircularBuffer& operator=(const MpmcCircularBuffer&) = delete;
+
+    // 요소 추가 (Reject: 가득 차 있으면 false, OverwriteOldest: 가장 오래된 요소를 버리고 항상 true)
+    bool try_push(const T& item) {
+        return push_impl(item);
+    }
+
+    bool try_push(T&& item) {
+        return push_impl(std::move(item));
+    }
+
+    // 맨 앞 요소를 꺼내 item에 저장 (비어 있으면 false)
+    bool try_pop(T& item) {
+        size_t position = head.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = buffer[position % max_size];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0) {
+                // 읽을 수 있는 칸: 위치를 차지하면 꺼내고 다음 바퀴의 생산자에게 넘김
+                if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    item = std::move(cell.data);
+                    cell.sequence.store(position + max_size, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false; // 비어 있음
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 현재 요소 개수 (다른 스레드가 사용 중이면 근사값)
+    size_t size() const {
+        size_t current_head = head.load(std::memory_order_acquire);
+        size_t current_tail = tail.load(std::memory_order_acquire);
+        return current_tail > current_head ? std::min(current_tail - current_head, max_size) : 0;
+    }
+
+    // 버퍼 용량 반환
+    size_t capacity() const {
+        return max_size;
+    }
+
+    // 버퍼가 비어있는지 확인 (다른 스레드가 사용 중이면 근사값)
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // OverwriteOldest 모드에서 버려진 요소 수
+    size_t overwritten_count() const {
+        return overwritten.load(std::memory_order_relaxed);
+    }
+};
+
+// 파일에 매핑된 순환 버퍼의 헤더 (파일 맨 앞 64바이트, 바로 뒤에 capacity개의 요소가 이어짐)
+// 다른 프로세스와 디스크에서도 같은 배치로 읽히도록 고정 크기의 단순 복사 가능한 구조체로 정의
+// head / tail은 std::atomic_ref로만 접근
+struct MappedRingHeader {
+    char magic[8];          // "RGTRING1"
+    uint32_t version;
+    uint32_t element_size;  // sizeof(T)
+    uint64_t capacity;
+    uint64_t head;          // 첫 번째 요소의 누적 위치
+    uint64_t tail;          // 마지막 요소 다음의 누적 위치
+    uint8_t reserved[24];
+
+    static constexpr char Magic[8] = {'R', 'G', 'T', 'R', 'I', 'N', 'G', '1'};
+    static constexpr uint32_t Version = 1;
+};
+static_assert(sizeof(MappedRingHeader) == 64, "헤더 크기는 64바이트로 고정");
+static_assert(std::is_trivially_copyable_v<MappedRingHeader>, "헤더는 단순 복사 가능해야 함");
+
+// 저장 공간과 head / tail이 메모리 매핑 파일에 있는 순환 버퍼
+// - 쓰기용(path, capacity): 기록하는 프로세스는 하나여야 하며, 같은 형식의 파일이 있으면 내용을 이어서 사용
+// - 읽기용(path): 다른 프로세스가 읽기 전용으로 매핑해 복사 없이 읽음
+// POSIX 공유 메모리로 쓰려면 /dev/shm 아래 경로를 사용 (디스크에 쓰지 않고 프로세스끼리만 공유)
+// 가득 차면 가장 오래된 요소를 덮어쓰며, 요소를 쓰기 전에 head를 먼저 옮기므로
+// 기록 중에 프로세스가 죽어도 [head, tail) 구간은 항상 온전한 요소만 가리킴
+template <typename T>
+class MappedCircularBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedCircularBuffer는 단순 복사 가능한 타입만 지원합니다");
+    static_assert(alignof(T) <= sizeof(MappedRingHeader), "요소 정렬은 64바이트 이하여야 합니다");
+
+private:
+    MappedRingHeader* header = nullptr;
+    T* buffer = nullptr;     // 헤더 바로 뒤 (64바이트 정렬)
+    size_t max_size = 0;
+    size_t mapped_bytes = 0;
+    bool writable = false;
+#ifdef _WIN32
+    HANDLE file_handle = INVALID_HANDLE_VALUE;
+    HANDLE mapping_handle = nullptr;
+#endif
+
+    static size_t file_size_for(size_t capacity) {
+        return sizeof(MappedRingHeader) + capacity * sizeof(T);
+    }
+
+    std::atomic_ref<uint64_t> head_ref() const {
+        return std::atomic_ref<uint64_t>(header->head);
+    }
+
+    std::atomic_ref<uint64_t> tail_ref() const {
+        return std::atomic_ref<uint64_t>(header->tail);
+    }
+
+    size_t slot(uint64_t position) const {
+        return static_cast<size_t>(position % max_size);
+    }
+
+    // 파일을 열어 bytes 크기로 매핑 (bytes가 0이면 현재 파일 크기 사용)
+    void map(const std::string& path, size_t bytes) {
+#ifdef _WIN32
+        file_handle = CreateFileA(path.c_str(), writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, writable ? OPEN_ALWAYS : OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("파일을 열 수 없습니다: " + path);
+        }
+        LARGE_INTEGER current;
+        if (!GetFileSizeEx(file_handle, &current)) {
+            throw std::runtime_error("파일 크기를 읽을 수 없습니다: " + path);
+        }
+        if (bytes == 0) {
+            bytes = static_cast<size_t>(current.QuadPart);
+        }
+        if (bytes < sizeof(MappedRingHeader)) {
+            throw std::runtime_error("순환 버퍼 파일이 아닙니다: " + path);
+        }
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(bytes);
+        mapping_handle = CreateFileMappingA(file_handle, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+                                            static_cast<DWORD>(size.HighPart), size.LowPart, nullptr);
+        if (mapping_handle == nullptr) {
+            throw std::runtime_error("파일을 매핑할 수 없습니다: " + path);
+        }
+        void* address = MapViewOfFile(mapping_handle, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, bytes);
+        if (address == nullptr) {
+            throw std::runtime_error("파일을 매핑할 수 없습니다: " + path);
+        }
+#else
+        int fd = ::open(path.c_str(), writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("파일을 열 수 없습니다: " + path);
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            ::close(fd);
+            throw std::runtime_error("파일 크기를 읽을 수 없습니다: " + path);
+        }
+        if (bytes == 0) {
+            bytes = static_cast<size_t>(status.st_size);
+        } else if (static_cast<size_t>(status.st_size) != bytes && ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            ::close(fd);
+            throw std::runtime_error("파일 크기를 바꿀 수 없습니다: " + path);
+        }
+        if (bytes < sizeof(MappedRingHeader)) {
+            ::close(fd);
+            throw std::runtime_error("순환 버퍼 파일이 아닙니다: " + path);
+        }
+        void* address = ::mmap(nullptr, bytes, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // 매핑은 파일 디스크립터를 닫아도 유지됨
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("파일을 매핑할 수 없습니다: " + path);
+        }
+#endif
+        mapped_bytes = bytes;
+        header = static_cast<MappedRingHeader*>(address);
+        buffer = reinterpret_cast<T*>(static_cast<char*>(address) + sizeof(MappedRingHeader));
+    }
+
+    void unmap() {
+#ifdef _WIN32
+        if (header != nullptr) {
+            UnmapViewOfFile(header);
+        }
+        if (mapping_handle != nullptr) {
+            CloseHandle(mapping_handle);
+        }
+        if (file_handle != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_handle);
+        }
+        mapping_handle = nullptr;
+        file_handle = INVALID_HANDLE_VALUE;
+#else
+        if (header != nullptr) {
+            ::munmap(header, mapped_bytes);
+        }
+#endif
+        header = nullptr;
+        buffer = nullptr;
+    }
+
+    bool header_matches(size_t capacity) const {
+        return std::memcmp(header->magic, MappedRingHeader::Magic, sizeof(header->magic)) == 0 &&
+               header->version == MappedRingHeader::Version && header->element_size == sizeof(T) &&
+               header->capacity > 0 && (capacity == 0 || header->capacity == capacity);
+    }
+
+public:
+    // 쓰기용으로 열기: 같은 형식(요소 크기, 용량)의 파일이면 저장된 내용을 이어서 사용하고, 아니면 새로 초기화
+    MappedCircularBuffer(const std::string& path, size_t capacity) : max_size(capacity), writable(true) {
+        if (capacity == 0) {
+            throw std::invalid_argument("용량은 0보다 커야 합니다");
+        }
+        try {
+            map(path, file_size_for(capacity));
+            uint64_t head = header->head;
+            uint64_t tail = header->tail;
+            if (!header_matches(capacity) || tail < head || tail - head > capacity) {
+                // 새 파일이거나 형식이 다르면 빈 버퍼로 초기화 (magic은 마지막에 기록)
+                std::memset(header, 0, sizeof(MappedRingHeader));
+                header->version = MappedRingHeader::Version;
+                header->element_size = sizeof(T);
+                header->capacity = capacity;
+                std::atomic_thread_fence(std::memory_order_release);
+                std::memcpy(header->magic, MappedRingHeader::Magic, sizeof(header->magic));
+            }
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    // 읽기 전용으로 열기 (다른 프로세스가 기록 중인 버퍼를 읽을 때 사용)
+    explicit MappedCircularBuffer(const std::string& path) : writable(false) {
+        try {
+            map(path, 0);
+            if (!header_matches(0) || mapped_bytes < file_size_for(header->capacity)) {
+                throw std::runtime_error("순환 버퍼 파일 형식이 다릅니다: " + path);
+            }
+            max_size = static_cast<size_t>(header->capacity);
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    MappedCircularBuffer(const MappedCircularBuffer&) = delete;
+    MappedCircularBuffer& operator=(const MappedCircularBuffer&) = delete;
+
+    ~MappedCircularBuffer() {
+        unmap();
+    }
+
+    // 요소 추가 (가득 찬 경우 가장 오래된 요소를 덮어씀, 쓰기용에서만 가능)
+    void push_back(const T& item) {
+        if (!writable) {
+            throw std::runtime_error("읽기 전용 버퍼입니다");
+        }
+        uint64_t tail = tail_ref().load(std::memory_order_relaxed);
+        uint64_t head = head_ref().load(std::memory_order_relaxed);
+        if (tail - head == max_size) {
+            // 덮어쓸 칸을 먼저 구간에서 빼고 나서 기록
+            head_ref().store(head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+        std::memcpy(buffer + slot(tail), &item, sizeof(T));
+        tail_ref().store(tail + 1, std::memory_order_release);
+    }
+
+    // 여러 요소 한 번에 추가 (가득 차면 가장 오래된 요소부터 덮어씀, 쓰기용에서만 가능)
+    void push_back(std::span<const T> items) {
+        if (!writable) {
+            throw std::runtime_error("읽기 전용 버퍼입니다");
+        }
+        uint64_t tail = tail_ref().load(std::memory_order_relaxed);
+        uint64_t head = head_ref().load(std::memory_order_relaxed);
+        if (items.size() > max_size) {
+            tail += items.size() - max_size; // 어차피 덮어써질 앞부분은 복사하지 않음
+            items = items.last(max_size);
+        }
+        uint64_t new_tail = tail + items.size();
+        if (new_tail - head > max_size) {
+            head_ref().store(new_tail - max_size, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        size_t start = slot(tail);
+        size_t first = std::min(items.size(), max_size - start);
+        std::memcpy(buffer + start, items.data(), first * sizeof(T));
+        std::memcpy(buffer, items.data() + first, (items.size() - first) * sizeof(T));
+        tail_ref().store(new_tail, std::memory_order_release);
+    }
+
+    // 가장 최근 최대 count개를 오래된 순서로 destination에 복사하고 복사한 개수 반환
+    // 복사하는 동안 기록하는 쪽이 덮어쓴 요소는 버리고, 남은 요소만 앞으로 당겨 반환 (seqlock과 같은 방식)
+    size_t copy_latest(T* destination, size_t count) const {
+        uint64_t tail = tail_ref().load(std::memory_order_acquire);
+        uint64_t head = head_ref().load(std::memory_order_acquire);
+        uint64_t available = tail > head ? std::min<uint64_t>(tail - head, max_size) : 0;
+        count = static_cast<size_t>(std::min<uint64_t>(count, available));
+        uint64_t first_position = tail - count;
+
+        size_t start = slot(first_position);
+        size_t first = std::min(count, max_size - start);
+        std::memcpy(destination, buffer + start, first * sizeof(T));
+        std::memcpy(destination + first, buffer, (count - first) * sizeof(T));
+
+        // 기록하는 쪽은 칸을 덮어쓰기 전에 head를 옮기므로, 복사 후 head를 다시 읽어 그보다 앞선 요소는 버림
+        // (복사 중 덮어써진 값을 읽었다면 fence 이후의 head 읽기는 옮겨진 head를 봄)
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t valid_from = head_ref().load(std::memory_order_relaxed);
+        if (valid_from > first_position) {
+            size_t lost = static_cast<size_t>(std::min<uint64_t>(valid_from - first_position, count));
+            std::memmove(destination, destination + lost, (count - lost) * sizeof(T));
+            count -= lost;
+        }
+        return count;
+    }
+
+    // 내용을 오래된 순서의 연속 구간 두 개로 반환 (복사 없음)
+    // 다른 프로세스가 기록 중이면 가장 오래된 쪽 요소가 읽는 도중 덮어써질 수 있으므로 일관된 사본이 필요하면 copy_latest 사용
+    std::pair<std::span<const T>, std::span<const T>> as_spans() const {
+        uint64_t tail = tail_ref().load(std::memory_order_acquire);
+        uint64_t head = head_ref().load(std::memory_order_acquire);
+        size_t count = static_cast<size_t>(tail > head ? std::min<uint64_t>(tail - head, max_size) : 0);
+        size_t start = slot(head);
+        size_t first = std::min(count, max_size - start);
+        return {std::span<const T>(buffer + start, first), std::span<const T>(buffer, count - first)};
+    }
+
+    // 맨 뒤 요소 반환 (다른 프로세스와 공유하므로 복사본 반환)
+    T back() const {
+        T item;
+        if (copy_latest(&item, 1) == 0) {
+            throw std::runtime_error("버퍼가 비어 있습니다");
+        }
+        return item;
+    }
+
+    // 버퍼 크기 반환 (다른 프로세스가 기록 중이면 근사값)
+    size_t size() const {
+        uint64_t tail = tail_ref().load(std::memory_order_acquire);
+        uint64_t head = head_ref().load(std::memory_order_acquire);
+        return static_cast<size_t>(tail > head ? std::min<uint64_t>(tail - head, max_size) : 0);
+    }
+
+    // 버퍼 용량 반환
+    size_t capacity() const {
+        return max_size;
+    }
+
+    // 버퍼가 비어있는지 확인
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // 지금까지 넣은 요소 수 (재시작해도 이어서 증가)
+    uint64_t total_pushed() const {
+        return tail_ref().load(std::memory_order_acquire);
+    }
+
+    // 변경 내용을 디스크에 기록 (프로세스 종료 후에도 남지만, 전원 장애에도 남기려면 호출)
+    void sync() {
+        if (!writable) {
+            return;
+        }
+#ifdef _WIN32
+        FlushViewOfFile(header, mapped_bytes);
+        FlushFileBuffers(file_handle);
+#else
+        ::msync(header, mapped_bytes, MS_SYNC);
+#endif
+    }
+};
@@ -0,0 +1,608 @@
+// CircularBuffer 성능 측정 (Google Benchmark)
+// 비교 대상: std::deque, boost::circular_buffer
+// 빌드: g++ -std=c++20 -O2 -pthread CircularBufferBenchmark.cpp -o CircularBufferBenchmark -lbenchmark
+#include <benchmark/benchmark.h>
+#include <boost/circular_buffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "CircularBuffer.h"
+
+namespace {
+
+// 용량: L1에 들어가는 크기부터 DRAM 크기까지 (double 기준 2KB, 64KB, 2MB, 32MB)
+const std::vector<int64_t> capacities = {256, 8192, 262144, 4194304};
+
+// 단순 복사 가능하지만 산술 타입이 아닌 64바이트 요소
+struct Payload {
+    std::array<uint64_t, 8> words{};
+};
+
+template <typename T>
+T make_value(int64_t i) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<T>(i & 0x7f);
+    } else {
+        T value;
+        value.words[0] = static_cast<uint64_t>(i);
+        return value;
+    }
+}
+
+template <typename T>
+uint64_t checksum(const T& value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<uint64_t>(value);
+    } else {
+        return value.words[0];
+    }
+}
+
+// 비교 대상을 같은 이름으로 다루기 위한 얇은 어댑터
+// 모두 용량이 고정된 순환 버퍼처럼 동작: 가득 차면 가장 오래된 요소를 버림
+template <typename T>
+struct DequeRing {
+    std::deque<T> items;
+    size_t max_size;
+
+    explicit DequeRing(size_t capacity) : max_size(capacity) {}
+
+    void push_back(const T& item) {
+        items.push_back(item);
+        if (items.size() > max_size) {
+            items.pop_front();
+        }
+    }
+
+    void pop_front() {
+        items.pop_front();
+    }
+
+    void push_bulk(const T* first, size_t count) {
+        items.insert(items.end(), first, first + count);
+        if (items.size() > max_size) {
+            items.erase(items.begin(), items.begin() + (items.size() - max_size));
+        }
+    }
+
+    void pop_bulk(size_t count) {
+        items.erase(items.begin(), items.begin() + count);
+    }
+
+    size_t copy_out(T* destination) const {
+        std::copy(items.begin(), items.end(), destination);
+        return items.size();
+    }
+
+    auto begin() { return items.begin(); }
+    auto end() { return items.end(); }
+    size_t size() const { return items.size(); }
+};
+
+template <typename T>
+struct BoostRing {
+    boost::circular_buffer<T> items;
+
+    explicit BoostRing(size_t capacity) : items(capacity) {}
+
+    void push_back(const T& item) {
+        items.push_back(item);
+    }
+
+    void pop_front() {
+        items.pop_front();
+    }
+
+    void push_bulk(const T* first, size_t count) {
+        items.insert(items.end(), first, first + count);
+    }
+
+    void pop_bulk(size_t count) {
+        items.erase_begin(count);
+    }
+
+    // array_one / array_two 길이로 복사하면 GCC 12가 길이의 상한을 몰라 -Wstringop-overflow를 내므로 반복자로 복사
+    size_t copy_out(T* destination) const {
+        std::copy(items.begin(), items.end(), destination);
+        return items.size();
+    }
+
+    auto begin() { return items.begin(); }
+    auto end() { return items.end(); }
+    size_t size() const { return items.size(); }
+};
+
+template <typename T, bool PowerOfTwo>
+struct RgtRing {
+    CircularBuffer<T, PowerOfTwo> items;
+
+    explicit RgtRing(size_t capacity) : items(capacity) {}
+
+    void push_back(const T& item) {
+        items.push_back(item);
+    }
+
+    void pop_front() {
+        items.pop_front();
+    }
+
+    void push_bulk(const T* first, size_t count) {
+        items.push_back(std::span<const T>(first, count));
+    }
+
+    void pop_bulk(size_t count) {
+        items.pop_front(count);
+    }
+
+    size_t copy_out(T* destination) const {
+        return items.copy_out(destination, items.size());
+    }
+
+    auto begin() { return items.begin(); }
+    auto end() { return items.end(); }
+    size_t size() const { return items.size(); }
+};
+
+template <typename Ring, typename T>
+void fill(Ring& ring, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        ring.push_back(make_value<T>(static_cast<int64_t>(i)));
+    }
+}
+
+// 가득 찬 상태에서 push_back 한 번 + pop_front 한 번 (큐로 사용할 때의 처리량)
+template <typename Ring, typename T>
+void BM_PushPop(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    Ring ring(capacity);
+    fill<Ring, T>(ring, capacity - 1);
+    int64_t i = 0;
+    for (auto _ : state) {
+        ring.push_back(make_value<T>(i++));
+        ring.pop_front();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 가득 찬 상태에서 push_back만 반복 (가장 오래된 요소 덮어쓰기)
+template <typename Ring, typename T>
+void BM_PushOverwrite(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    Ring ring(capacity);
+    fill<Ring, T>(ring, capacity);
+    int64_t i = 0;
+    for (auto _ : state) {
+        ring.push_back(make_value<T>(i++));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 가득 찬 버퍼 전체를 반복자로 순회
+template <typename Ring, typename T>
+void BM_Iterate(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    Ring ring(capacity);
+    fill<Ring, T>(ring, capacity + capacity / 3);  // 순환한 상태에서 측정
+    for (auto _ : state) {
+        uint64_t total = 0;
+        for (const T& item : ring) {
+            total += checksum(item);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(ring.size()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(ring.size() * sizeof(T)));
+}
+
+// 용량의 절반 크기 블록을 한 번에 넣고 한 번에 빼기
+template <typename Ring, typename T>
+void BM_BulkPushPop(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    size_t block_size = capacity / 2;
+    std::vector<T> block(block_size);
+    for (size_t i = 0; i < block_size; ++i) {
+        block[i] = make_value<T>(static_cast<int64_t>(i));
+    }
+    Ring ring(capacity);
+    fill<Ring, T>(ring, capacity / 3);
+    for (auto _ : state) {
+        ring.push_bulk(block.data(), block_size);
+        ring.pop_bulk(block_size);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(block_size));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(block_size * sizeof(T)));
+}
+
+// 순환한 상태의 내용 전체를 연속 메모리로 복사
+template <typename Ring, typename T>
+void BM_CopyOut(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    Ring ring(capacity);
+    fill<Ring, T>(ring, capacity + capacity / 3);
+    std::vector<T> destination(capacity);
+    for (auto _ : state) {
+        size_t copied = ring.copy_out(destination.data());
+        benchmark::DoNotOptimize(copied);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(ring.size() * sizeof(T)));
+}
+
+// 구간 통계: 새 값 하나를 넣을 때마다 합 / 평균 / 최소 / 최대를 조회
+template <typename T>
+void BM_StatisticsBuffer(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    StatisticsBuffer<T> window(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        window.push_back(make_value<T>(static_cast<int64_t>(i * 7)));
+    }
+    int64_t i = 0;
+    for (auto _ : state) {
+        window.push_back(make_value<T>(i++ * 7));
+        benchmark::DoNotOptimize(window.sum());
+        benchmark::DoNotOptimize(window.mean());
+        benchmark::DoNotOptimize(window.min());
+        benchmark::DoNotOptimize(window.max());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 같은 조회를 CircularBuffer의 벡터화된 전체 순회로 계산 (O(n))
+template <typename T>
+void BM_StatisticsVectorScan(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    CircularBuffer<T> window(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        window.push_back(make_value<T>(static_cast<int64_t>(i * 7)));
+    }
+    int64_t i = 0;
+    for (auto _ : state) {
+        window.push_back(make_value<T>(i++ * 7));
+        auto total = window.sum();
+        T minimum, maximum;
+        window.min_max(minimum, maximum);
+        benchmark::DoNotOptimize(total);
+        benchmark::DoNotOptimize(static_cast<double>(total) / window.size());
+        benchmark::DoNotOptimize(minimum);
+        benchmark::DoNotOptimize(maximum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 같은 조회를 boost::circular_buffer와 표준 알고리즘으로 계산 (O(n))
+template <typename T>
+void BM_StatisticsBoostScan(benchmark::State& state) {
+    size_t capacity = static_cast<size_t>(state.range(0));
+    boost::circular_buffer<T> window(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        window.push_back(make_value<T>(static_cast<int64_t>(i * 7)));
+    }
+    int64_t i = 0;
+    for (auto _ : state) {
+        window.push_back(make_value<T>(i++ * 7));
+        double total = std::accumulate(window.begin(), window.end(), 0.0);
+        auto [minimum, maximum] = std::minmax_element(window.begin(), window.end());
+        benchmark::DoNotOptimize(total);
+        benchmark::DoNotOptimize(total / window.size());
+        benchmark::DoNotOptimize(*minimum);
+        benchmark::DoNotOptimize(*maximum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// 지연 시간 히스토그램 (로그-선형 구간: 2의 거듭제곱 구간마다 16칸, 상대 오차 약 6%)
+class LatencyHistogram {
+private:
+    static constexpr int sub_bucket_bits = 4;
+    static constexpr int sub_buckets = 1 << sub_bucket_bits;
+    std::array<uint64_t, 64 * sub_buckets> counts{};
+    uint64_t total = 0;
+    uint64_t largest = 0;
+
+    static size_t bucket_of(uint64_t value) {
+        if (value < sub_buckets) {
+            return static_cast<size_t>(value);
+        }
+        int exponent = 63 - __builtin_clzll(value);
+        uint64_t fraction = (value >> (exponent - sub_bucket_bits)) & (sub_buckets - 1);
+        return static_cast<size_t>((exponent - sub_bucket_bits + 1) * sub_buckets + fraction);
+    }
+
+    // 구간의 대표값 (구간 상한)
+    static uint64_t upper_bound_of(size_t bucket) {
+        if (bucket < sub_buckets) {
+            return bucket;
+        }
+        int exponent = static_cast<int>(bucket / sub_buckets) + sub_bucket_bits - 1;
+        uint64_t fraction = bucket % sub_buckets;
+        return ((sub_buckets + fraction + 1) << (exponent - sub_bucket_bits)) - 1;
+    }
+
+public:
+    void merge(const LatencyHistogram& other) {
+        for (size_t bucket = 0; bucket < counts.size(); ++bucket) {
+            counts[bucket] += other.counts[bucket];
+        }
+        total += other.total;
+        largest = std::max(largest, other.largest);
+    }
+
+    void record(uint64_t nanoseconds) {
+        ++counts[bucket_of(nanoseconds)];
+        ++total;
+        largest = std::max(largest, nanoseconds);
+    }
+
+    uint64_t percentile(double fraction) const {
+        uint64_t target = static_cast<uint64_t>(fraction * static_cast<double>(total));
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < counts.size(); ++bucket) {
+            seen += counts[bucket];
+            if (seen > target) {
+                return std::min(upper_bound_of(bucket), largest);
+            }
+        }
+        return largest;
+    }
+
+    // 백분위 값을 Google Benchmark 카운터로 출력
+    void report(benchmark::State& state) const {
+        if (total == 0) {
+            return;
+        }
+        state.counters["p50_ns"] = static_cast<double>(percentile(0.50));
+        state.counters["p90_ns"] = static_cast<double>(percentile(0.90));
+        state.counters["p99_ns"] = static_cast<double>(percentile(0.99));
+        state.counters["p999_ns"] = static_cast<double>(percentile(0.999));
+        state.counters["max_ns"] = static_cast<double>(largest);
+    }
+};
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// 바쁜 대기: 코어 수가 적은 환경에서도 상대 스레드가 진행하도록 양보
+inline void relax() {
+    std::this_thread::yield();
+}
+
+// 스레드 간 큐 어댑터: try_push / try_pop
+template <typename T>
+struct SpscQueue {
+    SpscCircularBuffer<T> ring;
+    explicit SpscQueue(size_t capacity) : ring(capacity) {}
+    bool try_push(const T& item) { return ring.try_push(item); }
+    bool try_pop(T& item) { return ring.try_pop(item); }
+};
+
+template <typename T>
+struct MpmcQueue {
+    MpmcCircularBuffer<T> ring;
+    explicit MpmcQueue(size_t capacity) : ring(capacity) {}
+    bool try_push(const T& item) { return ring.try_push(item); }
+    bool try_pop(T& item) { return ring.try_pop(item); }
+};
+
+// 지금까지 쓰던 방식: boost::circular_buffer + std::mutex
+template <typename T>
+struct LockedBoostQueue {
+    std::mutex lock;
+    boost::circular_buffer<T> ring;
+
+    explicit LockedBoostQueue(size_t capacity) : ring(capacity) {}
+
+    bool try_push(const T& item) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (ring.full()) {
+            return false;
+        }
+        ring.push_back(item);
+        return true;
+    }
+
+    bool try_pop(T& item) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (ring.empty()) {
+            return false;
+        }
+        item = ring.front();
+        ring.pop_front();
+        return true;
+    }
+};
+
+// 생산자 1개 -> 소비자 1개 처리량, 요소마다 넣은 시각부터 꺼낸 시각까지의 지연 시간 기록
+// 큐가 계속 차 있는 상태라 지연 시간에는 대기열에 머문 시간이 포함됨
+template <typename Queue>
+void BM_ThreadedThroughput(benchmark::State& state) {
+    constexpr size_t batch = 4096;
+    Queue queue(static_cast<size_t>(state.range(0)));
+    std::atomic<bool> stop{false};
+    std::thread producer([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (!queue.try_push(now_ns())) {
+                relax();
+            }
+        }
+    });
+
+    LatencyHistogram histogram;
+    for (auto _ : state) {
+        for (size_t received = 0; received < batch;) {
+            uint64_t sent;
+            if (queue.try_pop(sent)) {
+                histogram.record(now_ns() - sent);
+                ++received;
+            } else {
+                relax();
+            }
+        }
+    }
+    stop.store(true);
+    producer.join();
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch));
+    histogram.report(state);
+}
+
+// 왕복 지연 시간: 요청 큐로 시각을 보내고 응답 큐로 되돌려 받음 (큐가 거의 비어 있는 상태의 지연 시간)
+template <typename Queue>
+void BM_PingPongLatency(benchmark::State& state) {
+    Queue requests(1024);
+    Queue responses(1024);
+    std::atomic<bool> stop{false};
+    std::thread echo([&] {
+        uint64_t value;
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (requests.try_pop(value)) {
+                while (!responses.try_push(value)) {
+                    relax();
+                }
+            } else {
+                relax();
+            }
+        }
+    });
+
+    LatencyHistogram histogram;
+    for (auto _ : state) {
+        while (!requests.try_push(now_ns())) {
+            relax();
+        }
+        uint64_t sent;
+        while (!responses.try_pop(sent)) {
+            relax();
+        }
+        histogram.record(now_ns() - sent);
+    }
+    stop.store(true);
+    echo.join();
+
+    state.SetItemsProcessed(state.iterations());
+    histogram.report(state);
+}
+
+// 생산자 N개 -> 소비자 M개 처리량과 지연 시간 (MPMC 비교)
+// 벤치마크 스레드는 조정만 하고, 반복마다 소비자 전체가 batch개를 꺼낼 때까지 기다림
+template <typename Queue>
+void BM_MultiThreadedThroughput(benchmark::State& state) {
+    constexpr size_t batch = 4096;
+    int producers = static_cast<int>(state.range(0));
+    int consumers = static_cast<int>(state.range(1));
+    Queue queue(4096);
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> consumed{0};
+    std::vector<LatencyHistogram> histograms(static_cast<size_t>(consumers));
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!queue.try_push(now_ns())) {
+                    relax();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            LatencyHistogram& histogram = histograms[static_cast<size_t>(c)];
+            uint64_t sent;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (queue.try_pop(sent)) {
+                    histogram.record(now_ns() - sent);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    relax();
+                }
+            }
+        });
+    }
+
+    uint64_t target = 0;
+    for (auto _ : state) {
+        target += batch;
+        while (consumed.load(std::memory_order_relaxed) < target) {
+            relax();
+        }
+    }
+    stop.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    LatencyHistogram histogram;
+    for (const LatencyHistogram& partial : histograms) {
+        histogram.merge(partial);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch));
+    histogram.report(state);
+}
+
+template <typename Benchmark>
+void apply_capacities(Benchmark* benchmark) {
+    for (int64_t capacity : capacities) {
+        benchmark->Arg(capacity);
+    }
+}
+
+}  // namespace
+
+// 단일 스레드 연산: 요소 타입 x 구현
+#define CIRCULARBUFFER_SINGLE_THREADED(Type)                                                               \
+    BENCHMARK_TEMPLATE(BM_PushPop, RgtRing<Type, false>, Type)->Apply(apply_capacities);                   \
+    BENCHMARK_TEMPLATE(BM_PushPop, RgtRing<Type, true>, Type)->Apply(apply_capacities);                    \
+    BENCHMARK_TEMPLATE(BM_PushPop, BoostRing<Type>, Type)->Apply(apply_capacities);                        \
+    BENCHMARK_TEMPLATE(BM_PushPop, DequeRing<Type>, Type)->Apply(apply_capacities);                        \
+    BENCHMARK_TEMPLATE(BM_PushOverwrite, RgtRing<Type, false>, Type)->Apply(apply_capacities);             \
+    BENCHMARK_TEMPLATE(BM_PushOverwrite, RgtRing<Type, true>, Type)->Apply(apply_capacities);              \
+    BENCHMARK_TEMPLATE(BM_PushOverwrite, BoostRing<Type>, Type)->Apply(apply_capacities);                  \
+    BENCHMARK_TEMPLATE(BM_PushOverwrite, DequeRing<Type>, Type)->Apply(apply_capacities);                  \
+    BENCHMARK_TEMPLATE(BM_Iterate, RgtRing<Type, false>, Type)->Apply(apply_capacities);                   \
+    BENCHMARK_TEMPLATE(BM_Iterate, RgtRing<Type, true>, Type)->Apply(apply_capacities);                    \
+    BENCHMARK_TEMPLATE(BM_Iterate, BoostRing<Type>, Type)->Apply(apply_capacities);                        \
+    BENCHMARK_TEMPLATE(BM_Iterate, DequeRing<Type>, Type)->Apply(apply_capacities);                        \
+    BENCHMARK_TEMPLATE(BM_BulkPushPop, RgtRing<Type, false>, Type)->Apply(apply_capacities);               \
+    BENCHMARK_TEMPLATE(BM_BulkPushPop, BoostRing<Type>, Type)->Apply(apply_capacities);                    \
+    BENCHMARK_TEMPLATE(BM_BulkPushPop, DequeRing<Type>, Type)->Apply(apply_capacities);                    \
+    BENCHMARK_TEMPLATE(BM_CopyOut, RgtRing<Type, false>, Type)->Apply(apply_capacities);                   \
+    BENCHMARK_TEMPLATE(BM_CopyOut, BoostRing<Type>, Type)->Apply(apply_capacities);                        \
+    BENCHMARK_TEMPLATE(BM_CopyOut, DequeRing<Type>, Type)->Apply(apply_capacities)
+
+CIRCULARBUFFER_SINGLE_THREADED(int32_t);
+CIRCULARBUFFER_SINGLE_THREADED(double);
+CIRCULARBUFFER_SINGLE_THREADED(Payload);
+
+// 구간 통계 조회 (산술 타입만)
+BENCHMARK_TEMPLATE(BM_StatisticsBuffer, int32_t)->Apply(apply_capacities);
+BENCHMARK_TEMPLATE(BM_StatisticsVectorScan, int32_t)->Apply(apply_capacities);
+BENCHMARK_TEMPLATE(BM_StatisticsBoostScan, int32_t)->Apply(apply_capacities);
+BENCHMARK_TEMPLATE(BM_StatisticsBuffer, double)->Apply(apply_capacities);
+BENCHMARK_TEMPLATE(BM_StatisticsVectorScan, double)->Apply(apply_capacities);
+BENCHMARK_TEMPLATE(BM_StatisticsBoostScan, double)->Apply(apply_capacities);
+
+// 스레드 간 전달 (처리량 + 지연 시간 백분위)
+BENCHMARK_TEMPLATE(BM_ThreadedThroughput, SpscQueue<uint64_t>)->Arg(1024)->Arg(65536)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadedThroughput, MpmcQueue<uint64_t>)->Arg(1024)->Arg(65536)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadedThroughput, LockedBoostQueue<uint64_t>)->Arg(1024)->Arg(65536)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPongLatency, SpscQueue<uint64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPongLatency, MpmcQueue<uint64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PingPongLatency, LockedBoostQueue<uint64_t>)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MultiThreadedThroughput, MpmcQueue<uint64_t>)->Args({2, 2})->Args({4, 4})->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MultiThreadedThroughput, LockedBoostQueue<uint64_t>)->Args({2, 2})->Args({4, 4})->UseRealTime();
+
+BENCHMARK_MAIN();
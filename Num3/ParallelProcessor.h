@@ -0,0 +1,1920 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <deque>
+#include <condition_variable>
+#include <exception>
+#include <type_traits>
+#include <span>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <optional>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+
+// 작업 가로채기(work stealing) 방식의 상주 스레드 풀
+// 작업자마다 자기 deque를 가지며, 자기 deque는 뒤에서(LIFO) 꺼내고 일이 없으면 다른 deque의 앞에서 가져감
+// parallel_for를 호출한 스레드도 작업 하나를 직접 실행하고, 끝나기를 기다리는 동안 남은 작업을 대신 실행함
+// 따라서 작업 안에서 다시 parallel_for를 호출해도(중첩 병렬) 스레드가 늘어나거나 교착되지 않음
+class ThreadPool {
+private:
+    // parallel_for 한 번에 해당하는 작업 묶음 (호출한 스레드의 스택에 있음)
+    struct Job {
+        void (*invoke)(void* body, size_t index);
+        void* body;
+        std::atomic<size_t> remaining;
+        std::mutex mutex;
+        std::condition_variable done;
+        bool finished = false;
+        std::exception_ptr error;  // 처음 발생한 예외
+
+        Job(void (*function)(void*, size_t), void* context, size_t count)
+            : invoke(function), body(context), remaining(count) {}
+    };
+
+    struct Task {
+        Job* job;
+        size_t index;
+    };
+
+    // 스레드별 계측 값 (큐를 잠그는 다른 스레드와 캐시 라인이 겹치지 않도록 따로 정렬)
+    struct alignas(64) Counters {
+        std::atomic<size_t> tasks{0};
+        std::atomic<size_t> steals{0};
+        std::atomic<int64_t> busy_ns{0};
+    };
+
+    // 서로 다른 작업자의 큐가 같은 캐시 라인을 쓰지 않도록 정렬
+    struct alignas(64) TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        Counters counters;
+    };
+
+    // 0 ~ 작업자 수 - 1: 작업자별 큐, 마지막: 풀 밖의 스레드가 넣는 큐
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued{0};    // 큐에 들어 있는 작업 수
+    std::atomic<size_t> sleepers{0};  // 잠든 작업자 수
+    bool stopping = false;
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+
+    // 현재 스레드가 작업자이면 소속 풀과 큐 번호
+    inline static thread_local ThreadPool* current_pool = nullptr;
+    inline static thread_local size_t current_index = 0;
+    // 현재 스레드에서 실행 중인 작업의 중첩 깊이 (중첩된 작업의 시간을 두 번 세지 않기 위함)
+    inline static thread_local unsigned int running_depth = 0;
+
+    size_t own_queue() const {
+        return current_pool == this ? current_index : workers.size();
+    }
+
+    void push_tasks(Job& job, size_t first, size_t last) {
+        TaskQueue& queue = *queues[own_queue()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (size_t i = first; i < last; ++i) {
+                queue.tasks.push_back(Task{&job, i});
+            }
+        }
+        queued.fetch_add(last - first);
+        // 잠든 작업자가 있을 때만 깨움 (queued 증가 후 sleepers를 읽으므로 깨우기를 놓치지 않음)
+        if (sleepers.load() > 0) {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            wake.notify_all();
+        }
+    }
+
+    // 자기 큐 뒤 -> 외부 큐 앞 -> 다른 작업자 큐 앞 순서로 작업을 찾음
+    bool pop_task(Task& task) {
+        size_t own = own_queue();
+        size_t count = queues.size();
+        for (size_t offset = 0; offset < count; ++offset) {
+            size_t index = (own + offset) % count;
+            TaskQueue& queue = *queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (offset == 0 && own < workers.size()) {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            } else {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+                // 다른 작업자의 큐에서 가져온 경우만 가로채기로 셈 (외부 큐는 제외)
+                if (index < workers.size()) {
+                    queues[own]->counters.steals.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            queued.fetch_sub(1);
+            return true;
+        }
+        return false;
+    }
+
+    void run(const Task& task) {
+        Job& job = *task.job;
+        Counters& counters = queues[own_queue()]->counters;
+        bool outermost = running_depth++ == 0;
+        auto start_time = outermost ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+        try {
+            job.invoke(job.body, task.index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (!job.error) {
+                job.error = std::current_exception();
+            }
+        }
+        --running_depth;
+        counters.tasks.fetch_add(1, std::memory_order_relaxed);
+        if (outermost) {
+            auto elapsed = std::chrono::steady_clock::now() - start_time;
+            counters.busy_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), std::memory_order_relaxed);
+        }
+        if (job.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // 기다리는 스레드는 finished를 잠금 안에서 확인한 뒤에만 Job을 해제함
+            std::lock_guard<std::mutex> lock(job.mutex);
+            job.finished = true;
+            job.done.notify_all();
+        }
+    }
+
+    void worker_loop(size_t index) {
+        current_pool = this;
+        current_index = index;
+        while (true) {
+            Task task;
+            if (pop_task(task)) {
+                run(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleepers.fetch_add(1);
+            wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+            sleepers.fetch_sub(1);
+            if (stopping && queued.load() == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    // 생성자: 작업자 스레드를 한 번만 만들어 두고 계속 재사용
+    explicit ThreadPool(unsigned int worker_count) {
+        if (worker_count == 0) {
+            worker_count = 1;
+        }
+        for (unsigned int i = 0; i <= worker_count; ++i) {
+            queues.push_back(std::make_unique<TaskQueue>());
+        }
+        workers.reserve(worker_count);
+        for (unsigned int i = 0; i < worker_count; ++i) {
+            workers.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // 프로그램 전체가 함께 쓰는 풀 (호출한 스레드도 일하므로 작업자는 하드웨어 스레드 수 - 1개)
+    static ThreadPool& shared() {
+        static ThreadPool pool([] {
+            unsigned int hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 1u;
+        }());
+        return pool;
+    }
+
+    // 동시에 실행될 수 있는 최대 스레드 수 (작업자 + 호출한 스레드)
+    unsigned int concurrency() const {
+        return static_cast<unsigned int>(workers.size()) + 1;
+    }
+
+    // 스레드별 누적 계측 값
+    struct WorkerMetrics {
+        size_t tasks;                         // 실행한 작업 수
+        size_t steals;                        // 다른 작업자의 큐에서 가져온 작업 수
+        std::chrono::nanoseconds busy_time;   // 작업을 실행한 시간 (중첩된 작업은 바깥 작업에 포함)
+    };
+
+    // 0 ~ 작업자 수 - 1: 작업자별, 마지막: 풀 밖의 스레드(parallel_for를 호출한 스레드)들의 합
+    std::vector<WorkerMetrics> metrics() const {
+        std::vector<WorkerMetrics> result;
+        result.reserve(queues.size());
+        for (const auto& queue : queues) {
+            result.push_back(WorkerMetrics{queue->counters.tasks.load(std::memory_order_relaxed),
+                                           queue->counters.steals.load(std::memory_order_relaxed),
+                                           std::chrono::nanoseconds(queue->counters.busy_ns.load(std::memory_order_relaxed))});
+        }
+        return result;
+    }
+
+    void reset_metrics() {
+        for (auto& queue : queues) {
+            queue->counters.tasks.store(0, std::memory_order_relaxed);
+            queue->counters.steals.store(0, std::memory_order_relaxed);
+            queue->counters.busy_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // body(0) ~ body(count - 1)을 풀에서 실행하고 모두 끝날 때까지 기다림
+    // 작업에서 던진 예외는 모든 작업이 끝난 뒤 호출한 스레드에서 다시 던짐
+    template <typename Body>
+    void parallel_for(size_t count, Body&& body) {
+        if (count == 0) {
+            return;
+        }
+        if (count == 1) {
+            body(0);
+            return;
+        }
+
+        using BodyType = std::remove_reference_t<Body>;
+        Job job([](void* context, size_t index) { (*static_cast<BodyType*>(context))(index); },
+                const_cast<void*>(static_cast<const void*>(&body)), count);
+        push_tasks(job, 1, count);
+        run(Task{&job, 0});
+
+        // 기다리는 동안 큐에 남은 작업을 대신 실행
+        while (job.remaining.load(std::memory_order_acquire) > 0) {
+            Task task;
+            if (!pop_task(task)) {
+                break;
+            }
+            run(task);
+        }
+
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done.wait(lock, [&job] { return job.finished; });
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+    }
+};
+
+// 반복 구간을 스레드에 나눠 주는 방식
+enum class SchedulePolicy {
+    Static,   // 스레드 수만큼 균등한 구간으로 한 번에 나눔
+    Dynamic,  // grain_size개씩 원자적 카운터로 가져감 (요소마다 비용이 다를 때)
+    Guided,   // 남은 양 / (2 * 스레드 수)개씩 가져가되 점점 줄여 grain_size까지 (처음엔 크게, 끝에선 작게)
+    Auto      // 처음 일부 요소의 처리 시간을 재서 grain_size를 정하고 Dynamic으로 실행 (기본값)
+};
+
+struct Schedule {
+    SchedulePolicy policy = SchedulePolicy::Auto;
+    size_t grain_size = 0;  // Dynamic / Guided의 최소 묶음 크기 (0이면 Dynamic은 1024, Guided는 1)
+};
+
+// process_with_progress가 콜백에 넘기는 진행 상황
+struct Progress {
+    size_t completed;                   // 처리가 끝난 요소 수 (구간이 끝날 때마다 갱신)
+    size_t total;
+    std::chrono::milliseconds elapsed;
+    bool finished;                      // 마지막 호출이면 true
+};
+
+// 실행 번호(runner)별 계측 결과 (ParallelProcessor::last_metrics)
+struct RunnerMetrics {
+    size_t items;                       // 처리한 요소 수
+    size_t chunks;                      // 처리한 구간 수
+    std::chrono::nanoseconds busy_time; // 구간을 처리한 시간
+};
+
+// for_each_chunk가 구간이 끝날 때마다 넘기는 구간 결과
+template <typename R>
+struct ChunkResult {
+    size_t runner = 0;                      // 구간을 처리한 실행 번호
+    size_t start = 0;                       // 구간 [start, end)
+    size_t end = 0;
+    R value{};                              // 구간에 대한 함수의 결과
+    std::chrono::nanoseconds elapsed{0};    // 함수를 실행한 시간
+};
+
+// [0, count)를 schedule에 따라 구간으로 나눠 풀에서 실행하고, 실제로 사용한 방식을 반환
+// body(runner, start, end): runner는 0 ~ threads - 1의 실행 번호 (같은 runner는 동시에 실행되지 않음)
+template <typename Body>
+Schedule run_chunks(ThreadPool& pool, unsigned int threads, size_t count, Schedule schedule, Body&& body) {
+    using Clock = std::chrono::steady_clock;
+    // Auto: 묶음 하나가 이 정도 시간이 걸리도록 grain_size를 정함 (스케줄링 비용이 묻히는 크기)
+    constexpr auto target_chunk_time = std::chrono::microseconds(50);
+    // Auto: 측정 구간이 이 시간을 넘거나, 남은 작업이 이보다 짧으면 측정을 멈춤
+    constexpr auto probe_time = std::chrono::microseconds(10);
+
+    size_t first = 0;
+    if (schedule.policy == SchedulePolicy::Auto) {
+        // 호출한 스레드에서 1, 2, 4, ...개씩 직접 처리하며 요소당 비용을 측정 (측정한 요소도 결과에 포함)
+        auto start_time = Clock::now();
+        size_t probe = 1;
+        while (first < count) {
+            size_t end = std::min(count, first + probe);
+            body(0, first, end);
+            first = end;
+            probe *= 2;
+            if (Clock::now() - start_time >= probe_time) {
+                break;
+            }
+        }
+        auto elapsed = Clock::now() - start_time;
+        double element_ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(first);
+        size_t remaining = count - first;
+        if (remaining == 0 || element_ns * static_cast<double>(remaining) < std::chrono::duration<double, std::nano>(target_chunk_time).count()) {
+            // 남은 일이 묶음 하나보다 작으면 나눠 실행하는 비용이 더 큼
+            if (remaining > 0) {
+                body(0, first, count);
+            }
+            return Schedule{SchedulePolicy::Static, count};
+        }
+        size_t grain = static_cast<size_t>(std::chrono::duration<double, std::nano>(target_chunk_time).count() / std::max(element_ns, 0.001));
+        // 모든 스레드가 여러 묶음을 가져가도록 상한을 둠 (부하 균형)
+        size_t balanced = std::max<size_t>(1, remaining / (4 * static_cast<size_t>(threads)));
+        schedule = Schedule{SchedulePolicy::Dynamic, std::clamp<size_t>(grain, 1, balanced)};
+    }
+
+    size_t remaining = count - first;
+    if (remaining == 0) {
+        return schedule;
+    }
+    if (schedule.policy == SchedulePolicy::Static) {
+        // 나머지를 앞쪽 구간에 하나씩 나눠 마지막 구간만 길어지지 않게 함
+        size_t runners = std::min<size_t>(threads, remaining);
+        size_t chunk_size = remaining / runners;
+        size_t extra = remaining % runners;
+        pool.parallel_for(runners, [&](size_t runner) {
+            size_t start = first + runner * chunk_size + std::min(runner, extra);
+            size_t end = start + chunk_size + (runner < extra ? 1 : 0);
+            body(runner, start, end);
+        });
+        return Schedule{SchedulePolicy::Static, chunk_size};
+    }
+
+    size_t grain = schedule.grain_size;
+    if (grain == 0) {
+        grain = schedule.policy == SchedulePolicy::Dynamic ? 1024 : 1;
+    }
+    size_t runners = std::min<size_t>(threads, (remaining + grain - 1) / grain);
+    std::atomic<size_t> next{first};
+    pool.parallel_for(runners, [&](size_t runner) {
+        while (true) {
+            size_t start;
+            size_t end;
+            if (schedule.policy == SchedulePolicy::Dynamic) {
+                start = next.fetch_add(grain, std::memory_order_relaxed);
+                if (start >= count) {
+                    return;
+                }
+                end = std::min(count, start + grain);
+            } else {
+                start = next.load(std::memory_order_relaxed);
+                do {
+                    if (start >= count) {
+                        return;
+                    }
+                    size_t left = count - start;
+                    end = start + std::min(left, std::max(grain, left / (2 * runners)));
+                } while (!next.compare_exchange_weak(start, end, std::memory_order_relaxed));
+            }
+            body(runner, start, end);
+        }
+    });
+    return Schedule{schedule.policy, grain};
+}
+
+template <typename T, typename Output, typename Chain>
+class Pipeline;
+
+// 2차원 처리에서 이미지 밖의 좌표를 읽을 때의 규칙
+enum class BorderMode {
+    Clamp,   // 가장 가까운 가장자리 값 (aa|abcd|dd)
+    Mirror,  // 가장자리를 제외하고 대칭 (cb|abcd|cb)
+    Wrap     // 반대쪽에서 이어짐 (cd|abcd|ab)
+};
+
+// 좌표 index를 border 규칙에 따라 [0, length) 안으로 옮김
+inline size_t resolve_border(std::ptrdiff_t index, size_t length, BorderMode border) {
+    auto limit = static_cast<std::ptrdiff_t>(length);
+    if (index >= 0 && index < limit) {
+        return static_cast<size_t>(index);
+    }
+    switch (border) {
+    case BorderMode::Clamp:
+        return index < 0 ? 0 : length - 1;
+    case BorderMode::Mirror: {
+        if (limit == 1) {
+            return 0;
+        }
+        // 주기 2 * (length - 1)로 접으므로 반지름이 이미지보다 커도 안쪽 좌표가 나옴
+        std::ptrdiff_t period = 2 * (limit - 1);
+        std::ptrdiff_t folded = index % period;
+        if (folded < 0) {
+            folded += period;
+        }
+        return static_cast<size_t>(folded < limit ? folded : period - folded);
+    }
+    case BorderMode::Wrap: {
+        std::ptrdiff_t wrapped = index % limit;
+        return static_cast<size_t>(wrapped < 0 ? wrapped + limit : wrapped);
+    }
+    }
+    return 0;
+}
+
+// 2차원 처리의 작업 단위 (이미지 좌표 [x, x + width) x [y, y + height))
+struct Tile {
+    size_t x;
+    size_t y;
+    size_t width;
+    size_t height;
+};
+
+// stencil 함수가 받는 한 요소의 주변 (|dx|, |dy| <= radius인 이웃을 읽을 수 있음)
+template <typename T>
+class Neighborhood {
+private:
+    const T* center;
+    std::ptrdiff_t stride;
+    size_t pixel_x;
+    size_t pixel_y;
+
+public:
+    Neighborhood(const T* center_element, size_t row_stride, size_t x, size_t y)
+        : center(center_element), stride(static_cast<std::ptrdiff_t>(row_stride)), pixel_x(x), pixel_y(y) {}
+
+    // (x + dx, y + dy) 위치의 요소 (이미지 밖이면 border 규칙으로 정한 요소)
+    const T& operator()(std::ptrdiff_t dx, std::ptrdiff_t dy) const {
+        return center[dy * stride + dx];
+    }
+
+    size_t x() const {
+        return pixel_x;
+    }
+
+    size_t y() const {
+        return pixel_y;
+    }
+};
+
+// float를 가장 가까운 정수로 반올림 (0.5는 0에서 먼 쪽, std::lround와 같지만 라이브러리 호출 없이 인라인됨)
+inline long round_to_integer(float value) {
+    return value >= 0.0f ? static_cast<long>(value + 0.5f) : -static_cast<long>(0.5f - value);
+}
+
+// 분리 가능한 합성곱에서 요소를 채널 값들로 다루는 방법 (산술 타입은 채널 1개, Pixel은 아래에서 특수화)
+template <typename T>
+struct ConvolutionChannels {
+    static constexpr size_t count = 1;
+
+    static float get(const T& value, size_t) {
+        return static_cast<float>(value);
+    }
+
+    static void set(T& value, size_t, float channel) {
+        if constexpr (std::is_integral_v<T>) {
+            value = static_cast<T>(round_to_integer(channel));
+        } else {
+            value = static_cast<T>(channel);
+        }
+    }
+};
+
+// 파이프라인의 시작 단계: 입력 요소를 그대로 다음 단계로 넘김
+struct PipelineSource {
+    template <typename Input, typename Sink>
+    void operator()(const Input& input, Sink&& sink) const {
+        sink(input);
+    }
+};
+
+// 이미지 처리를 위한 병렬 프로세서 템플릿 클래스
+template <typename T>
+class ParallelProcessor {
+private:
+    // 벡터로 생성했을 때 복사해 둔 데이터 (span으로 생성하면 비어 있음)
+    std::vector<T> storage;
+    // 처리할 데이터 (storage 또는 호출한 쪽이 소유한 메모리를 가리킴)
+    std::span<T> data;
+    // 스레드 개수 (한 번의 호출이 동시에 사용하는 최대 스레드 수)
+    unsigned int num_threads;
+    // 작업을 실행할 스레드 풀
+    ThreadPool& pool;
+    // 뮤텍스 (스레드 안전한 출력을 위함)
+    std::mutex output_mutex;
+    // process / filter / reduce의 구간 분할 방식
+    Schedule schedule;
+    // 마지막 호출에서 실제로 사용한 분할 방식 (Auto가 고른 grain_size 확인용)
+    Schedule used_schedule;
+
+    // 실행 번호별 계측 값 (요소마다가 아니라 구간이 끝날 때마다 갱신하며, 실행 번호마다 캐시 라인이 다름)
+    struct alignas(64) RunnerCounters {
+        std::atomic<size_t> items{0};
+        std::atomic<size_t> chunks{0};
+        std::atomic<int64_t> busy_ns{0};
+    };
+    std::unique_ptr<RunnerCounters[]> counters;
+
+    // 타일 하나가 쓰는 작업 버퍼의 목표 크기 (코어별 L2 캐시에 들어가는 정도)와 타일의 최대 너비
+    static constexpr size_t tile_bytes = 256 * 1024;
+    static constexpr size_t tile_columns = 256;
+
+    // [0, count)를 분할 방식에 따라 구간으로 나눠 풀에서 실행하고 실행 번호별로 계측
+    // items(start, end): 구간 [start, end)에 해당하는 요소 수
+    template <typename Body, typename ItemCount>
+    void run_instrumented(size_t count, Schedule policy, Body&& body, ItemCount&& items) {
+        for (unsigned int runner = 0; runner < num_threads; ++runner) {
+            counters[runner].items.store(0, std::memory_order_relaxed);
+            counters[runner].chunks.store(0, std::memory_order_relaxed);
+            counters[runner].busy_ns.store(0, std::memory_order_relaxed);
+        }
+        used_schedule = run_chunks(pool, num_threads, count, policy, [this, &body, &items](size_t runner, size_t start, size_t end) {
+            auto start_time = std::chrono::steady_clock::now();
+            body(runner, start, end);
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time).count();
+            // 같은 실행 번호는 동시에 실행되지 않으므로 원자적 덧셈 없이 읽고 씀 (다른 스레드는 읽기만 함)
+            RunnerCounters& counter = counters[runner];
+            counter.busy_ns.store(counter.busy_ns.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+            counter.chunks.store(counter.chunks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            counter.items.store(counter.items.load(std::memory_order_relaxed) + items(start, end), std::memory_order_relaxed);
+        });
+    }
+
+    // 데이터를 분할 방식에 따라 구간으로 나눠 풀에서 실행하고 실행 번호별로 계측
+    template <typename Body>
+    void for_each_range(Body&& body, Schedule policy) {
+        run_instrumented(data.size(), policy, body, [](size_t start, size_t end) { return end - start; });
+    }
+
+    // width x height 이미지를 tile_height행 x 최대 tile_columns열의 타일로 나눠 풀에서 실행
+    // 타일마다 비용이 비슷하지만 가장자리 타일은 작으므로 하나씩 원자적 카운터로 가져감
+    template <typename Body>
+    void for_each_tile(size_t width, size_t height, size_t tile_height, Body&& body) {
+        size_t tile_width = std::min(width, tile_columns);
+        size_t tiles_x = (width + tile_width - 1) / tile_width;
+        size_t tiles_y = (height + tile_height - 1) / tile_height;
+        auto tile_at = [=](size_t index) {
+            size_t x = (index % tiles_x) * tile_width;
+            size_t y = (index / tiles_x) * tile_height;
+            return Tile{x, y, std::min(tile_width, width - x), std::min(tile_height, height - y)};
+        };
+        run_instrumented(tiles_x * tiles_y, Schedule{SchedulePolicy::Dynamic, 1},
+                         [&body, &tile_at](size_t runner, size_t start, size_t end) {
+            for (size_t index = start; index < end; ++index) {
+                body(runner, tile_at(index));
+            }
+        }, [&tile_at](size_t start, size_t end) {
+            size_t pixels = 0;
+            for (size_t index = start; index < end; ++index) {
+                Tile tile = tile_at(index);
+                pixels += tile.width * tile.height;
+            }
+            return pixels;
+        });
+    }
+
+    // target[i] += weight * source[i] (count는 convolution_lanes의 배수)
+    // 길이를 모르는 반복문은 GCC -O2에서 벡터화되지 않으므로 고정 길이 묶음으로 나누고, 겹치지 않음을 __restrict로 알림
+    static constexpr size_t convolution_lanes = 8;
+    static void multiply_add(float* __restrict target, const float* __restrict source, float weight, size_t count) {
+        for (size_t i = 0; i < count; i += convolution_lanes) {
+            for (size_t lane = 0; lane < convolution_lanes; ++lane) {
+                target[i + lane] += weight * source[i + lane];
+            }
+        }
+    }
+
+    void check_dimensions(size_t width, size_t height) const {
+        if (width * height != data.size()) {
+            throw std::invalid_argument("픽셀 수가 width * height와 다릅니다");
+        }
+    }
+
+    // 진행 중인 호출에서 지금까지 처리가 끝난 요소 수
+    size_t completed_items() const {
+        size_t completed = 0;
+        for (unsigned int runner = 0; runner < num_threads; ++runner) {
+            completed += counters[runner].items.load(std::memory_order_relaxed);
+        }
+        return completed;
+    }
+
+    template <typename Body>
+    void for_each_range(Body&& body) {
+        for_each_range(body, schedule);
+    }
+
+    // 실행 번호별 (구간 시작 위치, 값) 목록을 구간 순서대로 하나로 모음
+    template <typename U>
+    static std::vector<std::pair<size_t, U>> gather_in_order(std::vector<std::vector<std::pair<size_t, U>>>& per_runner) {
+        std::vector<std::pair<size_t, U>> ordered;
+        for (auto& partials : per_runner) {
+            std::move(partials.begin(), partials.end(), std::back_inserter(ordered));
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return ordered;
+    }
+
+    template <typename, typename, typename>
+    friend class Pipeline;
+
+public:
+    // 생성자: 데이터와 스레드 개수 초기화
+    ParallelProcessor(const std::vector<T>& input_data, unsigned int threads = std::thread::hardware_concurrency(),
+                      ThreadPool& thread_pool = ThreadPool::shared())
+        : storage(input_data), data(storage), num_threads(threads == 0 ? 1 : threads), pool(thread_pool),
+          counters(std::make_unique<RunnerCounters[]>(num_threads)) {
+        // 하드웨어 스레드가 감지되지 않으면 기본값 4 사용
+        if (num_threads == 0) {
+            num_threads = 4;
+        }
+    }
+
+    // 생성자: 호출한 쪽의 메모리를 복사하지 않고 그대로 사용 (처리하는 동안 view가 유효해야 함)
+    ParallelProcessor(std::span<T> view, unsigned int threads = std::thread::hardware_concurrency(),
+                      ThreadPool& thread_pool = ThreadPool::shared())
+        : data(view), num_threads(threads == 0 ? 1 : threads), pool(thread_pool),
+          counters(std::make_unique<RunnerCounters[]>(num_threads)) {}
+
+    // 생성자: 연속 메모리 반복자 구간 [first, last)를 복사하지 않고 사용
+    template <std::contiguous_iterator Iterator>
+        requires std::is_same_v<std::iter_value_t<Iterator>, T>
+    ParallelProcessor(Iterator first, Iterator last, unsigned int threads = std::thread::hardware_concurrency(),
+                      ThreadPool& thread_pool = ThreadPool::shared())
+        : ParallelProcessor(std::span<T>(std::to_address(first), static_cast<size_t>(last - first)), threads, thread_pool) {}
+
+    // 처리할 데이터를 다른 메모리로 바꿈 (여러 단계를 두 버퍼로 번갈아 처리할 때 사용)
+    void set_input(std::span<T> view) {
+        // 생성할 때 복사해 둔 데이터는 새 view가 그 안을 가리키지 않을 때만 해제
+        bool inside_storage = !storage.empty() && view.data() >= storage.data() && view.data() < storage.data() + storage.size();
+        if (!inside_storage) {
+            std::vector<T>().swap(storage);
+        }
+        data = view;
+    }
+
+    // 처리할 데이터 (parallel_sort / process_in_place의 결과 확인용)
+    std::span<T> input() const {
+        return data;
+    }
+
+    // 구간 분할 방식 설정 (기본값 Auto)
+    void set_schedule(Schedule value) {
+        schedule = value;
+    }
+
+    const Schedule& get_schedule() const {
+        return schedule;
+    }
+
+    // 마지막 호출에서 실제로 사용한 분할 방식 (Auto는 측정한 비용으로 고른 Dynamic의 grain_size)
+    const Schedule& last_schedule() const {
+        return used_schedule;
+    }
+
+    // 마지막 호출의 실행 번호별 처리 요소 수, 구간 수, 처리 시간
+    // 스레드별 가로채기 횟수 등은 풀의 ThreadPool::metrics()로 확인
+    std::vector<RunnerMetrics> last_metrics() const {
+        std::vector<RunnerMetrics> result;
+        result.reserve(num_threads);
+        for (unsigned int runner = 0; runner < num_threads; ++runner) {
+            result.push_back(RunnerMetrics{counters[runner].items.load(std::memory_order_relaxed),
+                                           counters[runner].chunks.load(std::memory_order_relaxed),
+                                           std::chrono::nanoseconds(counters[runner].busy_ns.load(std::memory_order_relaxed))});
+        }
+        return result;
+    }
+
+    // 병렬 처리 메서드 - 함수형 프로그래밍 스타일
+    // 함수 객체를 템플릿으로 받으므로 요소마다 간접 호출이 없고, 단순한 람다는 인라인되어 벡터화될 수 있음
+    template <typename F>
+        requires std::is_invocable_r_v<T, F&, const T&>
+    std::vector<T> process(F&& func) {
+        // 결과를 저장할 벡터
+        std::vector<T> result(data.size());
+        
+        // 구간별 작업을 스레드 풀에서 실행하고 완료 대기
+        for_each_range([this, &func, &result](size_t, size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                result[j] = func(data[j]);
+            }
+        });
+        
+        return result;
+    }
+    
+    // 병렬 처리 메서드 (진행 상황 출력)
+    template <typename F>
+        requires std::is_invocable_r_v<T, F&, const T&>
+    std::vector<T> process_with_progress(F&& func) {
+        return process_with_progress(func, [this](const Progress& progress) {
+            std::lock_guard<std::mutex> lock(output_mutex);
+            if (!progress.finished) {
+                std::cout << "\r진행 상황: " << progress.completed << "/" << progress.total 
+                          << " (" << (progress.total == 0 ? 100 : progress.completed * 100 / progress.total) << "%) - "
+                          << "경과 시간: " << progress.elapsed.count() << "ms" << std::flush;
+            } else {
+                std::cout << "\r완료: " << progress.completed << "/" << progress.total 
+                          << " (100%) - 총 처리 시간: " << progress.elapsed.count() << "ms" << std::endl;
+            }
+        });
+    }
+    
+    // 병렬 처리 메서드 (진행 상황을 interval마다 on_progress로 전달)
+    // 진행 상황은 실행 번호별 카운터를 구간이 끝날 때마다 더해 두고 읽으므로 요소마다 공유 변수를 갱신하지 않음
+    // 별도 스레드 없이, 구간을 끝낸 작업자가 보고 시각이 지났으면 다음 보고 시각을 CAS로 차지해 on_progress를 호출함
+    // on_progress는 동시에 호출되지 않으며, 마지막 호출(finished == true)은 처리가 끝나는 즉시 이 함수를 호출한 스레드에서 이뤄짐
+    template <typename F, typename ProgressCallback>
+        requires std::is_invocable_r_v<T, F&, const T&> && std::is_invocable_v<ProgressCallback&, const Progress&>
+    std::vector<T> process_with_progress(F&& func, ProgressCallback&& on_progress,
+                                         std::chrono::milliseconds interval = std::chrono::milliseconds(100)) {
+        using Clock = std::chrono::steady_clock;
+        // 결과를 저장할 벡터
+        std::vector<T> result(data.size());
+        size_t total_size = data.size();
+        
+        // 시작 시간 기록
+        auto start_time = Clock::now();
+        auto elapsed = [start_time] {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time);
+        };
+        
+        // 다음 보고 시각 (시작 시각 기준 나노초), 보고 중에는 reporting으로 바꿔 다른 작업자가 끼어들지 않게 함
+        constexpr int64_t reporting = std::numeric_limits<int64_t>::max();
+        const int64_t interval_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+        std::atomic<int64_t> next_report{interval_ns};
+        
+        // 구간별 작업을 스레드 풀에서 실행하고 완료 대기
+        for_each_range([&](size_t, size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                result[j] = func(data[j]);
+            }
+            int64_t deadline = next_report.load(std::memory_order_relaxed);
+            if (deadline == reporting) {
+                return;
+            }
+            int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time).count();
+            if (now < deadline || !next_report.compare_exchange_strong(deadline, reporting, std::memory_order_acquire)) {
+                return;
+            }
+            // 이 구간은 아직 카운터에 더해지지 않았으므로 함께 셈
+            on_progress(Progress{std::min(total_size, completed_items() + (end - start)), total_size, elapsed(), false});
+            int64_t after = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time).count();
+            next_report.store(after + interval_ns, std::memory_order_release);
+        });
+        
+        // 완료 알림
+        on_progress(Progress{total_size, total_size, elapsed(), true});
+        
+        return result;
+    }
+    
+    // 입력을 제자리에서 변환 (새 벡터를 할당하지 않음)
+    template <typename F>
+        requires std::is_invocable_r_v<T, F&, const T&>
+    void process_in_place(F&& func) {
+        for_each_range([this, &func](size_t, size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                data[j] = func(data[j]);
+            }
+        });
+    }
+
+    // 구간마다 func(구간의 요소)의 결과를 구간이 끝나는 즉시 sink(ChunkResult<R>&&)로 넘김
+    // 결과를 벡터에 모아 반환하지 않으므로 구간 결과를 채널을 통해 다른 스레드로 바로 흘려보낼 때 사용
+    // sink는 작업자 스레드에서 동시에 호출되며, sink가 기다리는 동안 그 작업자는 다음 구간을 가져가지 않음
+    template <typename F, typename Sink, typename R = std::invoke_result_t<F&, std::span<const T>>>
+        requires std::is_invocable_v<Sink&, ChunkResult<R>&&>
+    void for_each_chunk(F&& func, Sink&& sink) {
+        for_each_range([this, &func, &sink](size_t runner, size_t start, size_t end) {
+            auto start_time = std::chrono::steady_clock::now();
+            R value = func(std::span<const T>(data.subspan(start, end - start)));
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+            sink(ChunkResult<R>{runner, start, end, std::move(value), elapsed});
+        });
+    }
+    
+    // 결과를 호출한 쪽이 준비한 버퍼에 기록 (output 크기는 입력과 같아야 함)
+    // output이 입력과 같은 메모리이면 제자리 변환과 같음. 일부만 겹치면 안 됨
+    template <typename U, typename F>
+        requires std::is_invocable_r_v<U, F&, const T&>
+    void map_into(std::span<U> output, F&& func) {
+        if (output.size() != data.size()) {
+            throw std::invalid_argument("출력 버퍼 크기가 입력 크기와 다릅니다");
+        }
+        for_each_range([this, &func, output](size_t, size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                output[j] = func(data[j]);
+            }
+        });
+    }
+    
+    template <typename U, typename F>
+        requires std::is_invocable_r_v<U, F&, const T&>
+    void map_into(std::vector<U>& output, F&& func) {
+        map_into(std::span<U>(output), func);
+    }
+    
+    // 맵 함수 - 함수형 프로그래밍 스타일
+    // 결과 요소 타입 U는 func의 반환 타입에서 추론하거나 map<U>(func)로 지정 (T와 달라도 됨)
+    template <typename U = void, typename F,
+              typename Result = std::conditional_t<std::is_void_v<U>, std::decay_t<std::invoke_result_t<F&, const T&>>, U>>
+        requires std::is_invocable_r_v<Result, F&, const T&>
+    std::vector<Result> map(F&& func) {
+        std::vector<Result> result(data.size());
+        
+        for_each_range([this, &func, &result](size_t, size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                result[j] = func(data[j]);
+            }
+        });
+        
+        return result;
+    }
+    
+    // 필터 함수 - 함수형 프로그래밍 스타일 (결과는 입력 순서 유지)
+    // 1) 구간마다 조건을 만족하는 요소 수를 셈 2) 구간 순서대로 배타적 누적 합을 구해 쓸 위치를 정함 3) 미리 할당한 결과에 동시에 기록
+    // 요소마다 predicate를 두 번 호출하므로 predicate는 같은 요소에 항상 같은 값을 반환해야 함
+    template <typename Predicate>
+        requires std::is_invocable_r_v<bool, Predicate&, const T&>
+    std::vector<T> filter(Predicate&& predicate) {
+        // 실행 번호별 (구간 시작 위치, (구간 끝 위치, 만족하는 요소 수)) 목록
+        std::vector<std::vector<std::pair<size_t, std::pair<size_t, size_t>>>> counts(num_threads);
+        
+        for_each_range([this, &predicate, &counts](size_t runner, size_t start, size_t end) {
+            size_t matched = 0;
+            for (size_t j = start; j < end; ++j) {
+                if (predicate(data[j])) {
+                    ++matched;
+                }
+            }
+            counts[runner].emplace_back(start, std::make_pair(end, matched));
+        });
+        
+        // 구간 순서대로 배타적 누적 합: 각 구간의 결과가 시작하는 위치
+        auto blocks = gather_in_order(counts);
+        std::vector<size_t> offsets(blocks.size());
+        size_t total = 0;
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            offsets[b] = total;
+            total += blocks[b].second.second;
+        }
+        
+        std::vector<T> result(total);
+        if (total == 0) {
+            return result;
+        }
+        run_chunks(pool, num_threads, blocks.size(), Schedule{SchedulePolicy::Dynamic, 1},
+                   [this, &predicate, &blocks, &offsets, &result](size_t, size_t first_block, size_t last_block) {
+            for (size_t b = first_block; b < last_block; ++b) {
+                // 만족하는 요소가 없는 구간은 다시 검사하지 않음
+                if (blocks[b].second.second == 0) {
+                    continue;
+                }
+                size_t target = offsets[b];
+                for (size_t j = blocks[b].first; j < blocks[b].second.first; ++j) {
+                    if (predicate(data[j])) {
+                        result[target++] = data[j];
+                    }
+                }
+            }
+        });
+        
+        return result;
+    }
+    
+    // 조건을 만족하는 요소 수 (결과를 담지 않으므로 할당 없음)
+    template <typename Predicate>
+        requires std::is_invocable_r_v<bool, Predicate&, const T&>
+    size_t count_if(Predicate&& predicate) {
+        std::vector<size_t> counts(num_threads, 0);
+        
+        for_each_range([this, &predicate, &counts](size_t runner, size_t start, size_t end) {
+            size_t matched = 0;
+            for (size_t j = start; j < end; ++j) {
+                if (predicate(data[j])) {
+                    ++matched;
+                }
+            }
+            counts[runner] += matched;
+        });
+        
+        return std::accumulate(counts.begin(), counts.end(), size_t{0});
+    }
+    
+    // 조건을 만족하는 요소를 앞쪽으로 모음 (제자리, 요소를 복사할 버퍼 없음)
+    // 반환값은 조건을 만족하는 요소 수이며, 각 부분 안의 순서는 유지되지 않음 (std::partition과 같음)
+    template <typename Predicate>
+        requires std::is_invocable_r_v<bool, Predicate&, const T&>
+    size_t partition(Predicate&& predicate) {
+        size_t count = data.size();
+        size_t runs = std::min<size_t>(num_threads, count);
+        if (runs < 2) {
+            return std::partition(data.begin(), data.end(), predicate) - data.begin();
+        }
+        
+        // 1) 구간마다 제자리 분할: 구간 r은 [bounds[r], splits[r])가 만족, [splits[r], bounds[r + 1])가 불만족
+        std::vector<size_t> bounds(runs + 1);
+        for (size_t r = 0; r <= runs; ++r) {
+            bounds[r] = r * (count / runs) + std::min(r, count % runs);
+        }
+        std::vector<size_t> splits(runs);
+        pool.parallel_for(runs, [this, &predicate, &bounds, &splits](size_t r) {
+            splits[r] = std::partition(data.begin() + bounds[r], data.begin() + bounds[r + 1], predicate) - data.begin();
+        });
+        size_t matched = 0;
+        for (size_t r = 0; r < runs; ++r) {
+            matched += splits[r] - bounds[r];
+        }
+        
+        // 2) [0, matched) 안의 불만족 요소와 [matched, count) 안의 만족 요소는 개수가 같으므로 순서대로 짝지어 교환
+        std::vector<std::pair<size_t, size_t>> misplaced_front;   // 앞쪽에 있어야 할 자리의 불만족 요소 구간
+        std::vector<std::pair<size_t, size_t>> misplaced_back;    // 뒤쪽에 있어야 할 자리의 만족 요소 구간
+        for (size_t r = 0; r < runs; ++r) {
+            if (splits[r] < std::min(bounds[r + 1], matched)) {
+                misplaced_front.emplace_back(splits[r], std::min(bounds[r + 1], matched));
+            }
+            if (std::max(bounds[r], matched) < splits[r]) {
+                misplaced_back.emplace_back(std::max(bounds[r], matched), splits[r]);
+            }
+        }
+        size_t misplaced = 0;
+        for (const auto& range : misplaced_front) {
+            misplaced += range.second - range.first;
+        }
+        if (misplaced == 0) {
+            return matched;
+        }
+        
+        // 교환할 k번째 요소의 위치를 찾으며 구간 목록을 따라 교환
+        auto locate = [](const std::vector<std::pair<size_t, size_t>>& ranges, size_t rank) {
+            size_t index = 0;
+            while (rank >= ranges[index].second - ranges[index].first) {
+                rank -= ranges[index].second - ranges[index].first;
+                ++index;
+            }
+            return std::make_pair(index, ranges[index].first + rank);
+        };
+        run_chunks(pool, num_threads, misplaced, Schedule{SchedulePolicy::Static},
+                   [this, &misplaced_front, &misplaced_back, &locate](size_t, size_t start, size_t end) {
+            auto [front_index, front_position] = locate(misplaced_front, start);
+            auto [back_index, back_position] = locate(misplaced_back, start);
+            size_t left = end - start;
+            while (left > 0) {
+                if (front_position == misplaced_front[front_index].second) {
+                    front_position = misplaced_front[++front_index].first;
+                }
+                if (back_position == misplaced_back[back_index].second) {
+                    back_position = misplaced_back[++back_index].first;
+                }
+                size_t step = std::min({left, misplaced_front[front_index].second - front_position,
+                                        misplaced_back[back_index].second - back_position});
+                std::swap_ranges(data.begin() + front_position, data.begin() + front_position + step, data.begin() + back_position);
+                front_position += step;
+                back_position += step;
+                left -= step;
+            }
+        });
+        
+        return matched;
+    }
+    
+    // 리듀스 함수 - 함수형 프로그래밍 스타일
+    template <typename F>
+        requires std::is_invocable_r_v<T, F&, const T&, const T&>
+    T reduce(F&& func, T initial_value) {
+        // 실행 번호별 (구간 시작 위치, 부분 결과) 목록
+        std::vector<std::vector<std::pair<size_t, T>>> partial_results(num_threads);
+        
+        for_each_range([this, &func, &partial_results](size_t runner, size_t start, size_t end) {
+            // 구간의 첫 요소에서 시작하므로 initial_value는 마지막 병합에서 한 번만 사용됨
+            T local_result = data[start];
+            
+            for (size_t j = start + 1; j < end; ++j) {
+                local_result = func(local_result, data[j]);
+            }
+            
+            partial_results[runner].emplace_back(start, local_result);
+        });
+        
+        // 부분 결과를 구간 순서대로 병합 (func가 결합 법칙만 만족하면 분할 방식과 상관없이 같은 결과)
+        T final_result = initial_value;
+        for (const auto& partial : gather_in_order(partial_results)) {
+            final_result = func(final_result, partial.second);
+        }
+        
+        return final_result;
+    }
+    
+    // 2차원 처리: 데이터를 width x height 이미지(행 우선)로 보고 요소마다 주변을 읽는 func를 적용
+    // 캐시에 들어가는 타일마다 반지름 radius의 가장자리(halo)까지 작업 버퍼로 복사한 뒤 처리하므로
+    // func는 이미지 경계를 신경 쓰지 않고 neighborhood(dx, dy)로 이웃을 읽음 (이미지 밖은 border 규칙)
+    template <typename F>
+        requires std::is_invocable_v<F&, const Neighborhood<T>&>
+    auto stencil(size_t width, size_t height, size_t radius, BorderMode border, F&& func)
+        -> std::vector<std::decay_t<std::invoke_result_t<F&, const Neighborhood<T>&>>> {
+        using Result = std::decay_t<std::invoke_result_t<F&, const Neighborhood<T>&>>;
+        check_dimensions(width, height);
+        std::vector<Result> result(data.size());
+        if (result.empty()) {
+            return result;
+        }
+        
+        size_t halo_width = std::min(width, tile_columns) + 2 * radius;
+        size_t halo_rows = std::max<size_t>(2 * radius + 1, tile_bytes / (halo_width * sizeof(T)));
+        std::vector<std::vector<T>> buffers(num_threads);
+        
+        for_each_tile(width, height, halo_rows - 2 * radius, [&](size_t runner, const Tile& tile) {
+            size_t stride = tile.width + 2 * radius;
+            size_t rows = tile.height + 2 * radius;
+            std::vector<T>& halo = buffers[runner];
+            halo.resize(stride * rows);
+            
+            // 타일과 주변 radius만큼을 복사 (이미지 안쪽 타일은 행 단위로 그대로 복사)
+            bool inside_x = tile.x >= radius && tile.x + tile.width + radius <= width;
+            for (size_t row = 0; row < rows; ++row) {
+                size_t source_y = resolve_border(static_cast<std::ptrdiff_t>(tile.y + row) - static_cast<std::ptrdiff_t>(radius), height, border);
+                const T* source = data.data() + source_y * width;
+                T* target = halo.data() + row * stride;
+                if (inside_x) {
+                    std::copy(source + tile.x - radius, source + tile.x - radius + stride, target);
+                } else {
+                    for (size_t column = 0; column < stride; ++column) {
+                        target[column] = source[resolve_border(static_cast<std::ptrdiff_t>(tile.x + column) - static_cast<std::ptrdiff_t>(radius), width, border)];
+                    }
+                }
+            }
+            
+            for (size_t y = 0; y < tile.height; ++y) {
+                const T* center = halo.data() + (y + radius) * stride + radius;
+                Result* output = result.data() + (tile.y + y) * width + tile.x;
+                for (size_t x = 0; x < tile.width; ++x) {
+                    output[x] = func(Neighborhood<T>(center + x, stride, tile.x + x, tile.y + y));
+                }
+            }
+        });
+        
+        return result;
+    }
+    
+    // 분리 가능한 합성곱: 가로 커널을 적용한 뒤 세로 커널을 적용 (가우시안 블러, 박스 블러, Sobel 등)
+    // 커널 길이는 홀수이며 가운데가 현재 위치. 요소는 ConvolutionChannels<T>로 채널별 float 값으로 계산함
+    // 타일마다 가로 결과를 (타일 높이 + 세로 커널 길이 - 1)행만 작업 버퍼에 두므로 중간 이미지를 만들지 않음
+    std::vector<T> convolve_separable(size_t width, size_t height, std::span<const float> horizontal,
+                                      std::span<const float> vertical, BorderMode border = BorderMode::Clamp) {
+        using Channels = ConvolutionChannels<T>;
+        constexpr size_t channels = Channels::count;
+        check_dimensions(width, height);
+        if (horizontal.size() % 2 == 0 || vertical.size() % 2 == 0) {
+            throw std::invalid_argument("합성곱 커널의 길이는 홀수여야 합니다");
+        }
+        std::vector<T> result(data.size());
+        if (result.empty()) {
+            return result;
+        }
+        
+        size_t radius_x = horizontal.size() / 2;
+        size_t radius_y = vertical.size() / 2;
+        size_t row_values = std::min(width, tile_columns) * channels;
+        size_t buffer_rows = std::max<size_t>(vertical.size(), tile_bytes / (row_values * sizeof(float)));
+        
+        // 실행 번호별 작업 버퍼: 주변을 포함한 입력 한 행, 가로 결과 행들, 세로 결과 한 행
+        struct Buffers {
+            std::vector<float> line;
+            std::vector<float> rows;
+            std::vector<float> sums;
+        };
+        std::vector<Buffers> buffers(num_threads);
+        
+        for_each_tile(width, height, buffer_rows - 2 * radius_y, [&](size_t runner, const Tile& tile) {
+            size_t values = tile.width * channels;
+            // 행 길이를 convolution_lanes의 배수로 늘려 multiply_add가 남는 요소 없이 처리하게 함 (늘린 값은 버림)
+            size_t padded = (values + convolution_lanes - 1) / convolution_lanes * convolution_lanes;
+            size_t rows = tile.height + 2 * radius_y;
+            Buffers& buffer = buffers[runner];
+            buffer.line.resize(2 * radius_x * channels + padded);
+            buffer.rows.resize(rows * padded);
+            buffer.sums.resize(padded);
+            
+            // 1) 가로: 입력 행을 채널 값으로 펼친 뒤 커널 위치마다 연속된 값들에 가중치를 곱해 더함
+            for (size_t row = 0; row < rows; ++row) {
+                size_t source_y = resolve_border(static_cast<std::ptrdiff_t>(tile.y + row) - static_cast<std::ptrdiff_t>(radius_y), height, border);
+                const T* source = data.data() + source_y * width;
+                bool inside_x = tile.x >= radius_x && tile.x + tile.width + radius_x <= width;
+                for (size_t column = 0; column < tile.width + 2 * radius_x; ++column) {
+                    size_t source_x = inside_x ? tile.x + column - radius_x
+                                               : resolve_border(static_cast<std::ptrdiff_t>(tile.x + column) - static_cast<std::ptrdiff_t>(radius_x), width, border);
+                    for (size_t channel = 0; channel < channels; ++channel) {
+                        buffer.line[column * channels + channel] = Channels::get(source[source_x], channel);
+                    }
+                }
+                float* target = buffer.rows.data() + row * padded;
+                std::fill(target, target + padded, 0.0f);
+                for (size_t k = 0; k < horizontal.size(); ++k) {
+                    multiply_add(target, buffer.line.data() + k * channels, horizontal[k], padded);
+                }
+            }
+            
+            // 2) 세로: 가로 결과의 위아래 행들에 가중치를 곱해 더한 뒤 요소로 되돌림
+            for (size_t y = 0; y < tile.height; ++y) {
+                float* sums = buffer.sums.data();
+                std::fill(sums, sums + padded, 0.0f);
+                for (size_t k = 0; k < vertical.size(); ++k) {
+                    multiply_add(sums, buffer.rows.data() + (y + k) * padded, vertical[k], padded);
+                }
+                T* output = result.data() + (tile.y + y) * width + tile.x;
+                for (size_t x = 0; x < tile.width; ++x) {
+                    for (size_t channel = 0; channel < channels; ++channel) {
+                        Channels::set(output[x], channel, sums[x * channels + channel]);
+                    }
+                }
+            }
+        });
+        
+        return result;
+    }
+    
+    // 지연 실행 파이프라인 시작: pipe().map(f).filter(p).reduce(op, init)
+    // 단계들은 마지막 연산(reduce / to_vector / count / for_each)을 호출할 때 한 번의 병렬 순회로 합쳐져 실행됨
+    Pipeline<T, T, PipelineSource> pipe() {
+        return Pipeline<T, T, PipelineSource>(*this, PipelineSource{});
+    }
+    
+    // 병렬 정렬 구현 (operator< 기준, 안정 정렬)
+    void parallel_sort() {
+        parallel_sort(std::less<>{});
+    }
+    
+    // 비교 함수로 병렬 정렬 (안정 정렬: 같은 값은 원래 순서 유지)
+    // 1) 스레드 수만큼의 구간을 각각 정렬 2) 출력 위치 기준으로 정렬된 구간들을 정확히 나눔 3) 나눈 조각마다 k-way 병합
+    template <typename Compare>
+    void parallel_sort(Compare comp) {
+        size_t count = data.size();
+        size_t runs = std::min<size_t>(num_threads, count);
+        if (runs < 2) {
+            std::stable_sort(data.begin(), data.end(), comp);
+            return;
+        }
+        
+        // 구간 경계: 구간 r은 [bounds[r], bounds[r + 1]), 병합 결과의 조각 p도 같은 경계를 사용
+        std::vector<size_t> bounds(runs + 1);
+        for (size_t r = 0; r <= runs; ++r) {
+            bounds[r] = r * (count / runs) + std::min(r, count % runs);
+        }
+        pool.parallel_for(runs, [this, &bounds, &comp](size_t r) {
+            std::stable_sort(data.begin() + bounds[r], data.begin() + bounds[r + 1], comp);
+        });
+        
+        // splits[p][r]: 결과의 bounds[p]번째 위치에 해당하는 구간 r의 분할 위치
+        std::vector<std::vector<size_t>> splits(runs + 1);
+        splits[0].assign(bounds.begin(), bounds.end() - 1);
+        splits[runs].assign(bounds.begin() + 1, bounds.end());
+        pool.parallel_for(runs - 1, [this, &bounds, &splits, &comp](size_t p) {
+            splits[p + 1] = split_at_rank(bounds, bounds[p + 1], comp);
+        });
+        
+        // 조각마다 독립적으로 병합한 뒤 제자리로 복사
+        std::vector<T> merged(count);
+        pool.parallel_for(runs, [this, &bounds, &splits, &merged, &comp](size_t p) {
+            merge_runs(splits[p], splits[p + 1], merged.data() + bounds[p], comp);
+        });
+        pool.parallel_for(runs, [this, &bounds, &merged](size_t p) {
+            std::move(merged.begin() + bounds[p], merged.begin() + bounds[p + 1], data.begin() + bounds[p]);
+        });
+    }
+    
+    // key(element)를 기준으로 병렬 정렬 (안정 정렬)
+    // 키가 정수이면 기수 정렬(radix sort), 아니면 키를 비교하는 parallel_sort
+    template <typename KeyFunction>
+        requires std::is_invocable_v<KeyFunction&, const T&>
+    void parallel_sort_by_key(KeyFunction key) {
+        using Key = std::decay_t<std::invoke_result_t<KeyFunction&, const T&>>;
+        if constexpr (std::is_integral_v<Key> && !std::is_same_v<Key, bool>) {
+            radix_sort(key);
+        } else {
+            parallel_sort([&key](const T& a, const T& b) { return key(a) < key(b); });
+        }
+    }
+    
+private:
+    // 정렬된 구간들을 합쳤을 때 rank번째 위치의 분할 위치를 구간마다 구함 (다중 구간 선택)
+    // 분할 위치 앞의 요소는 모두 뒤의 요소보다 크지 않고, 같은 값은 앞 구간부터 배정하므로 안정성이 유지됨
+    template <typename Compare>
+    std::vector<size_t> split_at_rank(const std::vector<size_t>& bounds, size_t rank, Compare& comp) const {
+        size_t runs = bounds.size() - 1;
+        // 구간마다 아직 정해지지 않은 범위 [low, high): low 앞은 답보다 작거나 같고, high부터는 답보다 크거나 같음
+        std::vector<size_t> low(bounds.begin(), bounds.end() - 1);
+        std::vector<size_t> high(bounds.begin() + 1, bounds.end());
+        std::vector<size_t> lower(runs);
+        std::vector<size_t> upper(runs);
+        while (true) {
+            // 남은 범위가 가장 긴 구간의 가운데 요소를 기준값으로 사용
+            size_t widest = 0;
+            for (size_t r = 1; r < runs; ++r) {
+                if (high[r] - low[r] > high[widest] - low[widest]) {
+                    widest = r;
+                }
+            }
+            if (high[widest] == low[widest]) {
+                return low;
+            }
+            const T& pivot = data[low[widest] + (high[widest] - low[widest]) / 2];
+            
+            // 구간마다 기준값보다 작은 요소 / 작거나 같은 요소의 끝 위치
+            size_t less = 0;
+            size_t less_equal = 0;
+            for (size_t r = 0; r < runs; ++r) {
+                lower[r] = std::lower_bound(data.begin() + low[r], data.begin() + high[r], pivot, comp) - data.begin();
+                upper[r] = std::upper_bound(data.begin() + lower[r], data.begin() + high[r], pivot, comp) - data.begin();
+                less += lower[r] - bounds[r];
+                less_equal += upper[r] - bounds[r];
+            }
+            
+            if (rank < less) {
+                high = lower;
+            } else if (rank > less_equal) {
+                low = upper;
+            } else {
+                // 기준값과 같은 요소들 사이에서 나뉨: 앞 구간의 같은 값부터 배정
+                size_t remaining = rank - less;
+                for (size_t r = 0; r < runs; ++r) {
+                    size_t take = std::min(remaining, upper[r] - lower[r]);
+                    lower[r] += take;
+                    remaining -= take;
+                }
+                return lower;
+            }
+        }
+    }
+    
+    // 구간 r의 [first[r], last[r])들을 output에 병합 (같은 값은 앞 구간 먼저)
+    template <typename Compare>
+    void merge_runs(const std::vector<size_t>& first, const std::vector<size_t>& last, T* output, Compare& comp) {
+        std::vector<size_t> position(first);
+        // 아직 남은 요소가 있는 구간 번호의 힙 (맨 앞 요소가 가장 작은 구간이 위)
+        std::vector<size_t> heap;
+        for (size_t r = 0; r < first.size(); ++r) {
+            if (first[r] < last[r]) {
+                heap.push_back(r);
+            }
+        }
+        auto later = [this, &position, &comp](size_t a, size_t b) {
+            const T& left = data[position[a]];
+            const T& right = data[position[b]];
+            if (comp(right, left)) {
+                return true;
+            }
+            return !comp(left, right) && b < a;
+        };
+        std::make_heap(heap.begin(), heap.end(), later);
+        
+        while (heap.size() > 1) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            size_t r = heap.back();
+            *output++ = std::move(data[position[r]]);
+            if (++position[r] < last[r]) {
+                std::push_heap(heap.begin(), heap.end(), later);
+            } else {
+                heap.pop_back();
+            }
+        }
+        if (!heap.empty()) {
+            size_t r = heap.front();
+            std::move(data.begin() + position[r], data.begin() + last[r], output);
+        }
+    }
+    
+    // 정수 키로 LSD 기수 정렬 (8비트씩, 안정 정렬)
+    // 모든 요소에서 같은 바이트는 건너뛰므로 0 ~ 765의 밝기 키는 2번만 분배함
+    template <typename KeyFunction>
+    void radix_sort(KeyFunction& key) {
+        using Key = std::decay_t<std::invoke_result_t<KeyFunction&, const T&>>;
+        using Unsigned = std::make_unsigned_t<Key>;
+        constexpr size_t bits = sizeof(Unsigned) * 8;
+        
+        size_t count = data.size();
+        if (count < 2) {
+            return;
+        }
+        size_t chunks = std::min<size_t>(num_threads, count);
+        std::vector<size_t> bounds(chunks + 1);
+        for (size_t c = 0; c <= chunks; ++c) {
+            bounds[c] = c * (count / chunks) + std::min(c, count % chunks);
+        }
+        
+        // 키를 한 번만 계산 (부호 있는 정수는 부호 비트를 뒤집어 부호 없는 순서와 맞춤)
+        std::vector<Unsigned> keys(count);
+        // 구간 첫 키와 달라지는 비트를 구간마다 모은 뒤 합침 (한 번도 바뀌지 않는 바이트는 분배 생략)
+        std::vector<Unsigned> first_keys(chunks);
+        std::vector<Unsigned> changed_bits(chunks);
+        pool.parallel_for(chunks, [this, &key, &keys, &bounds, &first_keys, &changed_bits](size_t c) {
+            Unsigned changed = 0;
+            for (size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+                Unsigned value = static_cast<Unsigned>(key(data[i]));
+                if constexpr (std::is_signed_v<Key>) {
+                    value ^= Unsigned(1) << (bits - 1);
+                }
+                keys[i] = value;
+                changed |= value ^ keys[bounds[c]];
+            }
+            first_keys[c] = keys[bounds[c]];
+            changed_bits[c] = changed;
+        });
+        Unsigned changed = 0;
+        for (size_t c = 0; c < chunks; ++c) {
+            changed |= changed_bits[c] | (first_keys[c] ^ first_keys[0]);
+        }
+        
+        std::vector<T> element_buffer(count);
+        std::vector<Unsigned> key_buffer(count);
+        T* source = data.data();
+        T* destination = element_buffer.data();
+        Unsigned* source_keys = keys.data();
+        Unsigned* destination_keys = key_buffer.data();
+        std::vector<std::array<size_t, 256>> offsets(chunks);
+        
+        for (size_t shift = 0; shift < bits; shift += 8) {
+            if (((changed >> shift) & 0xFF) == 0) {
+                continue;
+            }
+            // 구간별 바이트 값 개수
+            pool.parallel_for(chunks, [&](size_t c) {
+                std::array<size_t, 256>& histogram = offsets[c];
+                histogram.fill(0);
+                for (size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+                    ++histogram[(source_keys[i] >> shift) & 0xFF];
+                }
+            });
+            // (바이트 값, 구간) 순서의 배타적 누적 합 = 각 구간이 그 바이트 값을 쓰기 시작할 위치
+            size_t total = 0;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                for (size_t c = 0; c < chunks; ++c) {
+                    size_t digit_count = offsets[c][digit];
+                    offsets[c][digit] = total;
+                    total += digit_count;
+                }
+            }
+            // 구간 안에서는 입력 순서대로 분배하므로 안정 정렬
+            pool.parallel_for(chunks, [&](size_t c) {
+                std::array<size_t, 256>& offset = offsets[c];
+                for (size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+                    size_t target = offset[(source_keys[i] >> shift) & 0xFF]++;
+                    destination[target] = std::move(source[i]);
+                    destination_keys[target] = source_keys[i];
+                }
+            });
+            std::swap(source, destination);
+            std::swap(source_keys, destination_keys);
+        }
+        
+        // 분배 횟수가 홀수이면 결과가 보조 버퍼에 있으므로 제자리로 옮김
+        if (source != data.data()) {
+            pool.parallel_for(chunks, [&](size_t c) {
+                std::move(source + bounds[c], source + bounds[c + 1], data.begin() + bounds[c]);
+            });
+        }
+    }
+};
+
+// map / filter 단계를 하나의 요소 단위 함수(chain)로 합친 지연 실행 파이프라인
+// chain(input, sink): 입력 요소 하나를 모든 단계에 통과시키고, 남은 값마다 sink(value)를 호출
+// 구간마다 요소 하나씩 모든 단계를 거치므로 중간 결과 벡터를 만들지 않고 값이 레지스터 / 캐시에 머묾
+// 단계 함수는 여러 스레드에서 동시에 const로 호출됨
+template <typename T, typename Output, typename Chain>
+class Pipeline {
+private:
+    ParallelProcessor<T>& processor;
+    Chain chain;
+
+    template <typename, typename, typename>
+    friend class Pipeline;
+    friend class ParallelProcessor<T>;
+
+    Pipeline(ParallelProcessor<T>& owner, Chain stages) : processor(owner), chain(std::move(stages)) {}
+
+    // 구간 [start, end)의 입력을 모든 단계에 통과시키며 결과마다 sink 호출
+    template <typename Sink>
+    void run_range(size_t start, size_t end, Sink&& sink) const {
+        for (size_t j = start; j < end; ++j) {
+            chain(processor.data[j], sink);
+        }
+    }
+
+public:
+    // 각 값을 func(value)로 바꾸는 단계 추가 (결과 타입은 func의 반환 타입)
+    template <typename F>
+        requires std::is_invocable_v<const std::decay_t<F>&, const Output&>
+    auto map(F&& func) && {
+        using Next = std::decay_t<std::invoke_result_t<const std::decay_t<F>&, const Output&>>;
+        auto stages = [previous = std::move(chain), func = std::forward<F>(func)](const T& input, auto&& sink) {
+            previous(input, [&](const Output& value) { sink(func(value)); });
+        };
+        return Pipeline<T, Next, decltype(stages)>(processor, std::move(stages));
+    }
+
+    // predicate(value)가 true인 값만 남기는 단계 추가
+    template <typename Predicate>
+        requires std::is_invocable_r_v<bool, const std::decay_t<Predicate>&, const Output&>
+    auto filter(Predicate&& predicate) && {
+        auto stages = [previous = std::move(chain), predicate = std::forward<Predicate>(predicate)](const T& input, auto&& sink) {
+            previous(input, [&](const Output& value) {
+                if (predicate(value)) {
+                    sink(value);
+                }
+            });
+        };
+        return Pipeline<T, Output, decltype(stages)>(processor, std::move(stages));
+    }
+
+    // 남은 값을 func로 합침 (구간 순서대로 병합하므로 func는 결합 법칙만 만족하면 됨)
+    template <typename F>
+        requires std::is_invocable_r_v<Output, F&, const Output&, const Output&>
+    Output reduce(F&& func, Output initial_value) && {
+        std::vector<std::vector<std::pair<size_t, Output>>> partial_results(processor.num_threads);
+        processor.for_each_range([this, &func, &partial_results](size_t runner, size_t start, size_t end) {
+            std::optional<Output> local_result;
+            run_range(start, end, [&](const Output& value) {
+                if (local_result) {
+                    *local_result = func(*local_result, value);
+                } else {
+                    local_result.emplace(value);
+                }
+            });
+            if (local_result) {
+                partial_results[runner].emplace_back(start, std::move(*local_result));
+            }
+        });
+
+        Output final_result = initial_value;
+        for (const auto& partial : ParallelProcessor<T>::gather_in_order(partial_results)) {
+            final_result = func(final_result, partial.second);
+        }
+        return final_result;
+    }
+
+    // 남은 값을 입력 순서대로 벡터로 만듦
+    std::vector<Output> to_vector() && {
+        std::vector<std::vector<std::pair<size_t, std::vector<Output>>>> chunks(processor.num_threads);
+        processor.for_each_range([this, &chunks](size_t runner, size_t start, size_t end) {
+            std::vector<Output> local_result;
+            run_range(start, end, [&](const Output& value) { local_result.push_back(value); });
+            if (!local_result.empty()) {
+                chunks[runner].emplace_back(start, std::move(local_result));
+            }
+        });
+
+        auto ordered = ParallelProcessor<T>::gather_in_order(chunks);
+        size_t total = 0;
+        for (const auto& chunk : ordered) {
+            total += chunk.second.size();
+        }
+        std::vector<Output> result;
+        result.reserve(total);
+        for (auto& chunk : ordered) {
+            std::move(chunk.second.begin(), chunk.second.end(), std::back_inserter(result));
+        }
+        return result;
+    }
+
+    // 남은 값의 개수 (값을 저장하지 않음)
+    size_t count() && {
+        std::vector<size_t> counts(processor.num_threads, 0);
+        processor.for_each_range([this, &counts](size_t runner, size_t start, size_t end) {
+            size_t local_count = 0;
+            run_range(start, end, [&](const Output&) { ++local_count; });
+            counts[runner] += local_count;
+        });
+        return std::accumulate(counts.begin(), counts.end(), size_t{0});
+    }
+
+    // 남은 값마다 func 호출 (여러 스레드에서 동시에 호출됨, 순서 없음)
+    template <typename F>
+        requires std::is_invocable_v<F&, const Output&>
+    void for_each(F&& func) && {
+        processor.for_each_range([this, &func](size_t, size_t start, size_t end) {
+            run_range(start, end, [&](const Output& value) { func(value); });
+        });
+    }
+};
+
+// 이미지 처리 예제를 위한 픽셀 클래스
+struct Pixel {
+    int r, g, b;
+    
+    Pixel() : r(0), g(0), b(0) {}
+    Pixel(int r, int g, int b) : r(r), g(g), b(b) {}
+    
+    // 픽셀 값 더하기 (리듀스 연산에 사용)
+    Pixel operator+(const Pixel& other) const {
+        return Pixel(r + other.r, g + other.g, b + other.b);
+    }
+    
+    // 픽셀 값 비교 (정렬에 사용)
+    bool operator<=(const Pixel& other) const {
+        // 밝기 기준 비교
+        int brightness = r + g + b;
+        int other_brightness = other.r + other.g + other.b;
+        return brightness <= other_brightness;
+    }
+    
+    // 픽셀 값 비교 (정렬에 사용)
+    bool operator<(const Pixel& other) const {
+        // 밝기 기준 비교
+        int brightness = r + g + b;
+        int other_brightness = other.r + other.g + other.b;
+        return brightness < other_brightness;
+    }
+};
+
+// 합성곱에서 Pixel을 r, g, b 세 채널로 다룸 (결과는 반올림하며 0 ~ 255로 자르지 않음)
+template <>
+struct ConvolutionChannels<Pixel> {
+    static constexpr size_t count = 3;
+
+    static float get(const Pixel& pixel, size_t channel) {
+        return static_cast<float>(channel == 0 ? pixel.r : channel == 1 ? pixel.g : pixel.b);
+    }
+
+    static void set(Pixel& pixel, size_t channel, float value) {
+        int rounded = static_cast<int>(round_to_integer(value));
+        (channel == 0 ? pixel.r : channel == 1 ? pixel.g : pixel.b) = rounded;
+    }
+};
+
+// GCC / Clang 벡터 확장이 있으면 픽셀 커널을 SIMD로 수행 (x86은 SSE2 / AVX2로 컴파일됨)
+#if defined(__GNUC__) || defined(__clang__)
+#define PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS
+#if defined(__x86_64__) || defined(__i386__)
+#define PARALLELPROCESSOR_HAVE_AVX2
+#endif
+#endif
+
+// 채널 합(r + g + b, 최대 765)을 3으로 나눈 몫을 16비트 연산만으로 계산
+// 0 ~ 765의 모든 값에서 s / 3과 같고 중간값이 65535를 넘지 않음 (아래 static_assert로 확인)
+constexpr uint16_t divide_channel_sum_by_3(uint16_t sum) {
+    return static_cast<uint16_t>(((sum + 1) * 85 + (sum >> 2)) >> 8);
+}
+
+constexpr bool divide_channel_sum_by_3_is_exact() {
+    for (uint32_t sum = 0; sum <= 765; ++sum) {
+        if (divide_channel_sum_by_3(static_cast<uint16_t>(sum)) != sum / 3 || (sum + 1) * 85 + (sum >> 2) > 65535) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(divide_channel_sum_by_3_is_exact(), "divide_channel_sum_by_3는 0 ~ 765에서 정확해야 함");
+
+// 8비트 평면(채널별로 따로 저장된 배열)에 대한 픽셀 커널
+// 모든 벡터는 32바이트이며, AVX2를 지원하는 CPU에서는 AVX2로 컴파일한 커널을 한 번만 골라 사용
+class PixelKernels {
+private:
+    struct Kernels {
+        void (*brighten)(uint8_t* plane, size_t count, uint8_t amount);
+        void (*grayscale)(uint8_t* r, uint8_t* g, uint8_t* b, size_t count);
+        size_t (*count_brighter)(const uint8_t* r, const uint8_t* g, const uint8_t* b, size_t count, uint16_t threshold);
+        uint64_t (*sum)(const uint8_t* plane, size_t count);
+        const char* name;
+    };
+
+    static const Kernels& select() {
+        static const Kernels kernels = [] {
+#ifdef PARALLELPROCESSOR_HAVE_AVX2
+            if (__builtin_cpu_supports("avx2")) {
+                return Kernels{brighten_avx2, grayscale_avx2, count_brighter_avx2, sum_avx2, "avx2"};
+            }
+            return Kernels{brighten_default, grayscale_default, count_brighter_default, sum_default, "sse2"};
+#elif defined(PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS)
+            return Kernels{brighten_default, grayscale_default, count_brighter_default, sum_default, "vector"};
+#else
+            return Kernels{brighten_default, grayscale_default, count_brighter_default, sum_default, "scalar"};
+#endif
+        }();
+        return kernels;
+    }
+
+#ifdef PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS
+#define PARALLELPROCESSOR_INLINE [[gnu::always_inline]] inline
+    typedef uint8_t Bytes32 __attribute__((vector_size(32)));
+    typedef uint8_t Bytes16 __attribute__((vector_size(16)));
+    typedef uint16_t Words16 __attribute__((vector_size(32)));
+
+    // 벡터는 참조로 주고받음 (AVX 벡터를 값으로 반환하면 AVX2가 아닌 빌드와 ABI가 달라짐)
+    template <typename Vector>
+    PARALLELPROCESSOR_INLINE static void load(const uint8_t* source, Vector& value) {
+        std::memcpy(&value, source, sizeof(Vector));
+    }
+
+    template <typename Vector>
+    PARALLELPROCESSOR_INLINE static void store(uint8_t* destination, const Vector& value) {
+        std::memcpy(destination, &value, sizeof(Vector));
+    }
+
+    // 16개 픽셀의 채널 합 (16비트)
+    PARALLELPROCESSOR_INLINE static void channel_sums(const uint8_t* r, const uint8_t* g, const uint8_t* b, Words16& sum) {
+        Bytes16 red, green, blue;
+        load(r, red);
+        load(g, green);
+        load(b, blue);
+        sum = __builtin_convertvector(red, Words16) + __builtin_convertvector(green, Words16) + __builtin_convertvector(blue, Words16);
+    }
+#else
+#define PARALLELPROCESSOR_INLINE inline
+#endif
+
+    // 포화 덧셈: 255를 넘으면 255
+    PARALLELPROCESSOR_INLINE static void brighten_kernel(uint8_t* plane, size_t count, uint8_t amount) {
+        size_t i = 0;
+#ifdef PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS
+        for (; i + 32 <= count; i += 32) {
+            Bytes32 value;
+            load(plane + i, value);
+            Bytes32 added = value + amount;
+            // 넘친 칸은 비교 결과가 0xFF이므로 OR하면 255가 됨
+            store(plane + i, added | reinterpret_cast<Bytes32>(added < value));
+        }
+#endif
+        for (; i < count; ++i) {
+            unsigned int added = plane[i] + amount;
+            plane[i] = static_cast<uint8_t>(added > 255 ? 255 : added);
+        }
+    }
+
+    // (r + g + b) / 3을 세 채널에 모두 기록
+    PARALLELPROCESSOR_INLINE static void grayscale_kernel(uint8_t* r, uint8_t* g, uint8_t* b, size_t count) {
+        size_t i = 0;
+#ifdef PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS
+        for (; i + 16 <= count; i += 16) {
+            Words16 sum;
+            channel_sums(r + i, g + i, b + i, sum);
+            Bytes16 gray = __builtin_convertvector(((sum + 1) * 85 + (sum >> 2)) >> 8, Bytes16);
+            store(r + i, gray);
+            store(g + i, gray);
+            store(b + i, gray);
+        }
+#endif
+        for (; i < count; ++i) {
+            uint8_t gray = static_cast<uint8_t>(divide_channel_sum_by_3(static_cast<uint16_t>(r[i] + g[i] + b[i])));
+            r[i] = gray;
+            g[i] = gray;
+            b[i] = gray;
+        }
+    }
+
+    // r + g + b > threshold인 픽셀 수
+    PARALLELPROCESSOR_INLINE static size_t count_brighter_kernel(const uint8_t* r, const uint8_t* g, const uint8_t* b, size_t count, uint16_t threshold) {
+        size_t total = 0;
+        size_t i = 0;
+#ifdef PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS
+        // 16비트 칸별 개수가 넘치지 않도록 65535번마다 비움
+        while (i + 16 <= count) {
+            Words16 counts = {};
+            size_t block_end = i + 16 * std::min<size_t>(65535, (count - i) / 16);
+            for (; i < block_end; i += 16) {
+                // 조건을 만족하는 칸은 0xFFFF이므로 부호 없는 16비트로 빼면 1씩 증가
+                Words16 sum;
+                channel_sums(r + i, g + i, b + i, sum);
+                counts -= reinterpret_cast<Words16>(sum > threshold);
+            }
+            for (int lane = 0; lane < 16; ++lane) {
+                total += counts[lane];
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            total += static_cast<uint16_t>(r[i] + g[i] + b[i]) > threshold;
+        }
+        return total;
+    }
+
+    // 8비트 평면의 합
+    PARALLELPROCESSOR_INLINE static uint64_t sum_kernel(const uint8_t* plane, size_t count) {
+        uint64_t total = 0;
+        size_t i = 0;
+#ifdef PARALLELPROCESSOR_HAVE_VECTOR_EXTENSIONS
+        // 16비트 칸별 합이 넘치지 않도록 257번(255 * 257 = 65535)마다 비움
+        while (i + 16 <= count) {
+            Words16 sums = {};
+            size_t block_end = i + 16 * std::min<size_t>(257, (count - i) / 16);
+            for (; i < block_end; i += 16) {
+                Bytes16 value;
+                load(plane + i, value);
+                sums += __builtin_convertvector(value, Words16);
+            }
+            for (int lane = 0; lane < 16; ++lane) {
+                total += sums[lane];
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            total += plane[i];
+        }
+        return total;
+    }
+
+#undef PARALLELPROCESSOR_INLINE
+
+    static void brighten_default(uint8_t* plane, size_t count, uint8_t amount) {
+        brighten_kernel(plane, count, amount);
+    }
+
+    static void grayscale_default(uint8_t* r, uint8_t* g, uint8_t* b, size_t count) {
+        grayscale_kernel(r, g, b, count);
+    }
+
+    static size_t count_brighter_default(const uint8_t* r, const uint8_t* g, const uint8_t* b, size_t count, uint16_t threshold) {
+        return count_brighter_kernel(r, g, b, count, threshold);
+    }
+
+    static uint64_t sum_default(const uint8_t* plane, size_t count) {
+        return sum_kernel(plane, count);
+    }
+
+#ifdef PARALLELPROCESSOR_HAVE_AVX2
+    __attribute__((target("avx2"))) static void brighten_avx2(uint8_t* plane, size_t count, uint8_t amount) {
+        brighten_kernel(plane, count, amount);
+    }
+
+    __attribute__((target("avx2"))) static void grayscale_avx2(uint8_t* r, uint8_t* g, uint8_t* b, size_t count) {
+        grayscale_kernel(r, g, b, count);
+    }
+
+    __attribute__((target("avx2"))) static size_t count_brighter_avx2(const uint8_t* r, const uint8_t* g, const uint8_t* b, size_t count, uint16_t threshold) {
+        return count_brighter_kernel(r, g, b, count, threshold);
+    }
+
+    __attribute__((target("avx2"))) static uint64_t sum_avx2(const uint8_t* plane, size_t count) {
+        return sum_kernel(plane, count);
+    }
+#endif
+
+public:
+    static void brighten(uint8_t* plane, size_t count, uint8_t amount) {
+        select().brighten(plane, count, amount);
+    }
+
+    static void grayscale(uint8_t* r, uint8_t* g, uint8_t* b, size_t count) {
+        select().grayscale(r, g, b, count);
+    }
+
+    static size_t count_brighter(const uint8_t* r, const uint8_t* g, const uint8_t* b, size_t count, uint16_t threshold) {
+        return select().count_brighter(r, g, b, count, threshold);
+    }
+
+    static uint64_t sum(const uint8_t* plane, size_t count) {
+        return select().sum(plane, count);
+    }
+
+    // 선택된 구현 이름 ("avx2", "sse2", "vector", "scalar")
+    static const char* implementation() {
+        return select().name;
+    }
+};
+
+// 채널을 8비트 평면으로 따로 저장하는 이미지 (구조체 배열 대신 배열 구조체, SoA)
+// Pixel(int 3개, 12바이트) 대신 픽셀당 3바이트이고, 같은 채널이 연속해 있어 32픽셀을 한 번에 처리할 수 있음
+// 연산은 스레드 풀에서 구간별로 나눠 PixelKernels로 실행
+class PlanarImage {
+private:
+    size_t image_width = 0;
+    size_t image_height = 0;
+    std::vector<uint8_t> red_plane;
+    std::vector<uint8_t> green_plane;
+    std::vector<uint8_t> blue_plane;
+
+    // 픽셀 구간 [0, size())를 threads개 스레드로 나눠 실행 (0이면 풀의 동시 실행 수)
+    template <typename Body>
+    void for_each_range(ThreadPool& pool, unsigned int threads, Body&& body) const {
+        if (threads == 0) {
+            threads = pool.concurrency();
+        }
+        run_chunks(pool, threads, size(), Schedule{SchedulePolicy::Static}, body);
+    }
+
+    static uint8_t clamp_channel(int value) {
+        return static_cast<uint8_t>(std::clamp(value, 0, 255));
+    }
+
+public:
+    PlanarImage() = default;
+
+    // 생성자: width x height 크기의 검은 이미지
+    PlanarImage(size_t width, size_t height)
+        : image_width(width), image_height(height),
+          red_plane(width * height), green_plane(width * height), blue_plane(width * height) {}
+
+    // Pixel 배열에서 생성 (채널 값은 0 ~ 255로 자름)
+    static PlanarImage from_pixels(std::span<const Pixel> pixels, size_t width, size_t height) {
+        if (pixels.size() != width * height) {
+            throw std::invalid_argument("픽셀 수가 width * height와 다릅니다");
+        }
+        PlanarImage image(width, height);
+        for (size_t i = 0; i < pixels.size(); ++i) {
+            image.red_plane[i] = clamp_channel(pixels[i].r);
+            image.green_plane[i] = clamp_channel(pixels[i].g);
+            image.blue_plane[i] = clamp_channel(pixels[i].b);
+        }
+        return image;
+    }
+
+    // Pixel 배열로 변환
+    std::vector<Pixel> to_pixels() const {
+        std::vector<Pixel> pixels(size());
+        for (size_t i = 0; i < pixels.size(); ++i) {
+            pixels[i] = Pixel(red_plane[i], green_plane[i], blue_plane[i]);
+        }
+        return pixels;
+    }
+
+    // 모든 채널에 amount를 더함 (255에서 포화)
+    void brighten(uint8_t amount, ThreadPool& pool = ThreadPool::shared(), unsigned int threads = 0) {
+        for_each_range(pool, threads, [this, amount](size_t, size_t start, size_t end) {
+            PixelKernels::brighten(red_plane.data() + start, end - start, amount);
+            PixelKernels::brighten(green_plane.data() + start, end - start, amount);
+            PixelKernels::brighten(blue_plane.data() + start, end - start, amount);
+        });
+    }
+
+    // 그레이스케일 변환: 세 채널을 모두 (r + g + b) / 3으로
+    void to_grayscale(ThreadPool& pool = ThreadPool::shared(), unsigned int threads = 0) {
+        for_each_range(pool, threads, [this](size_t, size_t start, size_t end) {
+            PixelKernels::grayscale(red_plane.data() + start, green_plane.data() + start, blue_plane.data() + start, end - start);
+        });
+    }
+
+    // r + g + b > threshold인 픽셀 수
+    size_t count_brighter(int threshold, ThreadPool& pool = ThreadPool::shared(), unsigned int threads = 0) const {
+        if (threshold < 0) {
+            return size();
+        }
+        if (threshold >= 765) {
+            return 0;
+        }
+        std::vector<size_t> counts(threads == 0 ? pool.concurrency() : threads, 0);
+        for_each_range(pool, threads, [this, threshold, &counts](size_t runner, size_t start, size_t end) {
+            counts[runner] += PixelKernels::count_brighter(red_plane.data() + start, green_plane.data() + start,
+                                                           blue_plane.data() + start, end - start, static_cast<uint16_t>(threshold));
+        });
+        return std::accumulate(counts.begin(), counts.end(), size_t{0});
+    }
+
+    // 채널별 합 {r, g, b}
+    std::array<uint64_t, 3> channel_sums(ThreadPool& pool = ThreadPool::shared(), unsigned int threads = 0) const {
+        std::vector<std::array<uint64_t, 3>> sums(threads == 0 ? pool.concurrency() : threads, std::array<uint64_t, 3>{});
+        for_each_range(pool, threads, [this, &sums](size_t runner, size_t start, size_t end) {
+            sums[runner][0] += PixelKernels::sum(red_plane.data() + start, end - start);
+            sums[runner][1] += PixelKernels::sum(green_plane.data() + start, end - start);
+            sums[runner][2] += PixelKernels::sum(blue_plane.data() + start, end - start);
+        });
+        std::array<uint64_t, 3> total{};
+        for (const auto& partial : sums) {
+            for (int channel = 0; channel < 3; ++channel) {
+                total[channel] += partial[channel];
+            }
+        }
+        return total;
+    }
+
+    size_t width() const {
+        return image_width;
+    }
+
+    size_t height() const {
+        return image_height;
+    }
+
+    size_t size() const {
+        return image_width * image_height;
+    }
+
+    // 채널 평면 (행 우선 순서, 크기 size())
+    std::span<uint8_t> red() { return red_plane; }
+    std::span<uint8_t> green() { return green_plane; }
+    std::span<uint8_t> blue() { return blue_plane; }
+    std::span<const uint8_t> red() const { return red_plane; }
+    std::span<const uint8_t> green() const { return green_plane; }
+    std::span<const uint8_t> blue() const { return blue_plane; }
+};
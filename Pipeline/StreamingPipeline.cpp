@@ -0,0 +1,78 @@
+#include <iostream>
+#include <vector>
+#include <span>
+#include <functional>
+
+#include "StreamingPipeline.h"
+
+// 밝은 픽셀 수 (구간 하나)
+size_t count_bright(std::span<const Pixel> pixels) {
+    size_t count = 0;
+    for (const Pixel& p : pixels) {
+        count += (p.r + p.g + p.b) > 500 ? 1 : 0;
+    }
+    return count;
+}
+
+void print_stats(const PipelineStats& stats) {
+    std::cout << "구간 수: " << stats.chunks << ", 요소 수: " << stats.items
+              << ", 작업자 대기: " << stats.producer_waits << "회, 소비자 대기: " << stats.consumer_waits << "회"
+              << ", 기록 실패: " << stats.failed_records << std::endl;
+    std::cout << "처리 시간 합: " << std::chrono::duration_cast<std::chrono::microseconds>(stats.busy_time).count() << "us"
+              << ", 전체 시간: " << std::chrono::duration_cast<std::chrono::microseconds>(stats.elapsed).count() << "us" << std::endl;
+}
+
+// 테스트 코드
+int main() {
+    // 테스트 이미지 데이터 생성 (1000x1000 픽셀, ParallelProcessor 예제와 같은 패턴)
+    std::vector<Pixel> image_data;
+    const int width = 1000;
+    const int height = 1000;
+    image_data.reserve(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            image_data.emplace_back((x * 255) / width, (y * 255) / height, ((x + y) * 255) / (width + height));
+        }
+    }
+    ParallelProcessor<Pixel> processor(std::span<Pixel>(image_data), 4);
+    // 구간이 너무 잘게 나뉘지 않도록 16384개씩 나눔 (구간마다 레코드가 한 줄씩 기록됨)
+    processor.set_schedule(Schedule{SchedulePolicy::Dynamic, 16384});
+
+    std::cout << "1. 구간 결과를 채널로 보내 집계하고 비동기 로그로 기록" << std::endl;
+    {
+        LogFileManager manager(AsyncOptions{});
+        LogFileManager::LogHandle handle = manager.openLogFile("pipeline.log", FlushPolicy::buffered());
+        StreamingPipeline<size_t> pipeline(manager, handle);
+
+        size_t bright_pixels = pipeline.run(processor, count_bright, size_t(0), std::plus<>{});
+        std::cout << "밝은 픽셀 수: " << bright_pixels << " (count_if: "
+                  << processor.count_if([](const Pixel& p) { return (p.r + p.g + p.b) > 500; }) << ")" << std::endl;
+        print_stats(pipeline.last_stats());
+
+        manager.flushAll();
+        std::cout << "\n// pipeline.log 마지막 3줄" << std::endl;
+        for (const auto& line : manager.tailLogs("pipeline.log", 3)) {
+            std::cout << line << std::endl;
+        }
+    }
+
+    std::cout << "\n2. 역압: 로그 큐 16건, 채널 4칸" << std::endl;
+    {
+        AsyncOptions options;
+        options.queueCapacity = 16;
+        options.batchSize = 4;
+        options.overflowPolicy = OverflowPolicy::Block;
+        LogFileManager manager(options);
+        // 레코드마다 flush하므로 writer 스레드가 느려 로그 큐가 가득 참
+        LogFileManager::LogHandle handle = manager.openLogFile("pipeline.log", FlushPolicy::immediate());
+        StreamingPipeline<size_t> pipeline(manager, handle, PipelineOptions{4, 16});
+
+        processor.set_schedule(Schedule{SchedulePolicy::Dynamic, 1024});
+        size_t bright_pixels = pipeline.run(processor, count_bright, size_t(0), std::plus<>{});
+        std::cout << "밝은 픽셀 수: " << bright_pixels << std::endl;
+        print_stats(pipeline.last_stats());
+        manager.closeLogFile("pipeline.log");
+    }
+
+    return 0;
+}
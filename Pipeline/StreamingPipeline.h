@@ -0,0 +1,328 @@
+#pragma once
+
+// ParallelProcessor → 채널(MpmcCircularBuffer) → 소비자 스레드 → LogFileManager로 이어지는 스트리밍 처리
+// 작업자는 구간이 끝날 때마다 결과를 채널에 넣고, 상주하는 소비자 스레드 하나가 꺼내 집계하며 로그로 기록함
+// 결과를 벡터에 모았다가 다시 순회하지 않으므로 구간 결과는 채널의 칸 하나에만 잠시 머묾
+// 단계마다 공간이 유한하므로 로그 쪽이 밀리면 앞 단계가 차례로 기다림 (역압)
+//   로그 큐가 가득 참 (AsyncOptions의 OverflowPolicy::Block) → 소비자가 writeRecord에서 대기
+//   → 채널이 가득 참 → 작업자가 push에서 대기하며 다음 구간을 가져가지 않음
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "LogFileManager.h"
+#include "CircularBuffer.h"
+#include "ParallelProcessor.h"
+
+// MpmcCircularBuffer에 기다리는 push / pop과 닫기를 더한 유한 채널
+// 가득 차거나 비어 있으면 spin_count번 양보하며 다시 시도한 뒤 조건 변수로 잠듦
+// 상대편은 잠든 스레드가 있을 때만 잠금을 잡고 깨우므로, 기다리는 스레드가 없으면 push / pop에 잠금이 없음
+template <typename T>
+class BlockingChannel {
+private:
+    MpmcCircularBuffer<T> buffer;
+    size_t spin_count;
+
+    std::mutex mutex;
+    std::condition_variable space_available;
+    std::condition_variable item_available;
+    std::atomic<size_t> sleeping_producers{0};
+    std::atomic<size_t> sleeping_consumers{0};
+    std::atomic<bool> closed{false};
+
+    // 잠든 횟수 (누적)
+    std::atomic<size_t> producer_waits{0};
+    std::atomic<size_t> consumer_waits{0};
+
+    // 상대편에 잠든 스레드가 있으면 깨움
+    // 잠드는 쪽은 sleepers를 늘린 뒤 버퍼를 다시 확인하므로, 양쪽의 울타리가 둘 중 하나는 상대의 변경을 보게 함
+    void wake(std::atomic<size_t>& sleepers, std::condition_variable& condition) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            condition.notify_all();
+        }
+    }
+
+public:
+    // 생성자
+    explicit BlockingChannel(size_t capacity, size_t spins = 64) : buffer(capacity), spin_count(spins) {}
+
+    BlockingChannel(const BlockingChannel&) = delete;
+    BlockingChannel& operator=(const BlockingChannel&) = delete;
+
+    // 요소 추가 (가득 차 있으면 공간이 생길 때까지 대기, 닫힌 채널이면 false)
+    bool push(T item) {
+        // try_push는 성공했을 때만 item을 옮기므로 실패한 뒤에도 item을 다시 쓸 수 있음
+        for (size_t attempt = 0; attempt < spin_count; ++attempt) {
+            if (closed.load(std::memory_order_acquire)) {
+                return false;
+            }
+            if (buffer.try_push(std::move(item))) {
+                wake(sleeping_consumers, item_available);
+                return true;
+            }
+            std::this_thread::yield();
+        }
+
+        producer_waits.fetch_add(1, std::memory_order_relaxed);
+        bool pushed;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            sleeping_producers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while (!(pushed = buffer.try_push(std::move(item))) && !closed.load(std::memory_order_acquire)) {
+                space_available.wait(lock);
+            }
+            sleeping_producers.fetch_sub(1);
+        }
+        if (pushed) {
+            wake(sleeping_consumers, item_available);
+        }
+        return pushed;
+    }
+
+    // 맨 앞 요소를 꺼내 item에 저장 (비어 있으면 요소가 들어올 때까지 대기, 닫히고 비어 있으면 false)
+    bool pop(T& item) {
+        for (size_t attempt = 0; attempt < spin_count; ++attempt) {
+            if (buffer.try_pop(item)) {
+                wake(sleeping_producers, space_available);
+                return true;
+            }
+            if (closed.load(std::memory_order_acquire)) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+
+        bool popped;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            sleeping_consumers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool waited = false;
+            while (!(popped = buffer.try_pop(item)) && !closed.load(std::memory_order_acquire)) {
+                waited = true;
+                item_available.wait(lock);
+            }
+            sleeping_consumers.fetch_sub(1);
+            if (waited) {
+                consumer_waits.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (popped) {
+            wake(sleeping_producers, space_available);
+        }
+        return popped;
+    }
+
+    // 채널 닫기: 이후의 push는 실패하고, pop은 남은 요소를 모두 꺼낸 뒤 false를 반환
+    void close() {
+        closed.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(mutex);
+        space_available.notify_all();
+        item_available.notify_all();
+    }
+
+    // 현재 요소 개수 (다른 스레드가 사용 중이면 근사값)
+    size_t size() const {
+        return buffer.size();
+    }
+
+    size_t capacity() const {
+        return buffer.capacity();
+    }
+
+    // 가득 차서 생산자가 잠든 횟수 (누적)
+    size_t producer_wait_count() const {
+        return producer_waits.load(std::memory_order_relaxed);
+    }
+
+    // 비어서 소비자가 잠든 횟수 (누적)
+    size_t consumer_wait_count() const {
+        return consumer_waits.load(std::memory_order_relaxed);
+    }
+};
+
+// StreamingPipeline 설정
+struct PipelineOptions {
+    size_t channel_capacity = 1024;  // 채널에 담을 수 있는 최대 구간 결과 수
+    size_t spin_count = 64;          // 채널이 가득 차거나 비었을 때 잠들기 전에 다시 시도하는 횟수
+};
+
+// 한 번의 run에 대한 통계
+struct PipelineStats {
+    size_t chunks = 0;                     // 소비자가 집계한 구간 수
+    size_t items = 0;                      // 그 구간들의 요소 수
+    size_t producer_waits = 0;             // 채널이 가득 차 작업자가 잠든 횟수 (역압이 작업자까지 전달된 횟수)
+    size_t consumer_waits = 0;             // 채널이 비어 소비자가 잠든 횟수
+    size_t failed_records = 0;             // 기록하지 못한 레코드 수 (DropNewest 정책으로 버려진 경우 등)
+    std::chrono::nanoseconds busy_time{0}; // 작업자가 구간을 처리한 시간의 합
+    std::chrono::nanoseconds elapsed{0};   // run 전체 시간 (마지막 레코드를 로그 큐에 넣을 때까지)
+};
+
+// 구간 결과를 채널로 받아 집계하고 로그로 기록하는 스트리밍 처리 (R: 구간 결과 타입)
+// 로그 레코드는 구간마다 "chunk start={} end={} runner={} elapsed_us={} value={}" 한 줄과
+// run이 끝날 때 "run chunks={} items={} producer_waits={} elapsed_us={} value={}" 한 줄이며,
+// R은 writeRecord가 지원하는 타입(정수, 실수, bool, char, 문자열)이어야 함
+// 소비자 스레드는 생성할 때 한 번만 만들고 run마다 재사용함
+template <typename R>
+class StreamingPipeline {
+private:
+    // 채널의 요소: 구간 결과 또는 run이 끝났다는 표시 (작업자들이 모두 넣은 뒤에 넣으므로 항상 마지막에 꺼냄)
+    struct Message {
+        bool end_of_run = false;
+        ChunkResult<R> chunk;
+    };
+
+    LogFileManager& manager;
+    LogFileManager::LogHandle handle;
+    BlockingChannel<Message> channel;
+
+    // run이 설정하고 소비자 스레드만 사용하는 집계 상태 (채널의 push / pop이 순서를 보장)
+    // combine은 run마다 타입이 다르므로 ThreadPool의 Job처럼 함수 포인터와 문맥 포인터로 보관
+    void* combine_context = nullptr;
+    void (*combine_step)(void*, R&, const R&) = nullptr;
+    R total{};
+    PipelineStats stats;
+    std::exception_ptr consumer_error;
+
+    // run이 끝났음을 소비자가 알림
+    std::mutex run_mutex;
+    std::condition_variable run_finished;
+    bool finished = false;
+
+    // run은 한 번에 하나만 실행
+    std::mutex serial_mutex;
+    PipelineStats previous_stats;
+    std::thread consumer;
+
+    void consume_loop() {
+        Message message;
+        while (channel.pop(message)) {
+            if (message.end_of_run) {
+                finish_run();
+                continue;
+            }
+            const ChunkResult<R>& chunk = message.chunk;
+            if (!consumer_error) {
+                try {
+                    combine_step(combine_context, total, chunk.value);
+                } catch (...) {
+                    consumer_error = std::current_exception(); // 남은 구간은 집계하지 않고 run에서 다시 던짐
+                }
+            }
+            ++stats.chunks;
+            stats.items += chunk.end - chunk.start;
+            stats.busy_time += chunk.elapsed;
+            auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(chunk.elapsed).count();
+            if (!manager.writeRecord(handle, Severity::Info, "chunk start={} end={} runner={} elapsed_us={} value={}",
+                                     chunk.start, chunk.end, chunk.runner, elapsed_us, chunk.value)) {
+                ++stats.failed_records;
+            }
+        }
+    }
+
+    void finish_run() {
+        {
+            std::lock_guard<std::mutex> lock(run_mutex);
+            finished = true;
+        }
+        run_finished.notify_one();
+    }
+
+public:
+    // 생성자: handle은 manager에서 연 로그 파일 (역압을 쓰려면 AsyncOptions의 OverflowPolicy::Block으로 만든 manager)
+    StreamingPipeline(LogFileManager& log_manager, LogFileManager::LogHandle log_handle, PipelineOptions options = {})
+        : manager(log_manager), handle(std::move(log_handle)), channel(options.channel_capacity, options.spin_count) {
+        if (!handle) {
+            throw std::invalid_argument("로그 파일 핸들이 비어 있습니다");
+        }
+        consumer = std::thread(&StreamingPipeline::consume_loop, this);
+    }
+
+    StreamingPipeline(const StreamingPipeline&) = delete;
+    StreamingPipeline& operator=(const StreamingPipeline&) = delete;
+
+    ~StreamingPipeline() {
+        channel.close();
+        consumer.join();
+    }
+
+    // processor의 구간마다 func(구간의 요소)를 실행해 결과를 채널로 보내고, 소비자 스레드가 combine으로 집계하며 기록
+    // 구간 결과는 끝난 순서대로 도착하므로 combine은 교환 / 결합 법칙을 만족해야 함 (합, 개수, 최대 / 최소 등)
+    // 처리나 combine에서 예외가 나면 이미 보낸 구간을 소비자가 모두 꺼낸 뒤 다시 던짐
+    template <typename T, typename F, typename Combine>
+        requires std::is_invocable_r_v<R, F&, std::span<const T>> && std::is_invocable_r_v<R, Combine&, const R&, const R&>
+    R run(ParallelProcessor<T>& processor, F&& func, R init, Combine&& combine) {
+        std::lock_guard<std::mutex> serial(serial_mutex);
+        auto start_time = std::chrono::steady_clock::now();
+        size_t producer_waits = channel.producer_wait_count();
+        size_t consumer_waits = channel.consumer_wait_count();
+
+        // 소비자는 이전 run의 끝 표시까지 처리했으므로 지금은 상태를 읽지 않음
+        using CombineType = std::remove_reference_t<Combine>;
+        combine_context = const_cast<void*>(static_cast<const void*>(&combine));
+        combine_step = [](void* context, R& value, const R& chunk) {
+            value = (*static_cast<CombineType*>(context))(std::as_const(value), chunk);
+        };
+        total = std::move(init);
+        stats = PipelineStats{};
+        consumer_error = nullptr;
+        finished = false;
+
+        std::exception_ptr producer_error;
+        try {
+            // 결과를 R로 바꿔 두어 func가 R로 변환 가능한 타입을 반환해도 같은 ChunkResult<R>로 보냄
+            auto chunk_func = [&func](std::span<const T> elements) -> R { return func(elements); };
+            processor.for_each_chunk(chunk_func, [this](ChunkResult<R>&& chunk) {
+                channel.push(Message{false, std::move(chunk)});
+            });
+        } catch (...) {
+            producer_error = std::current_exception();
+        }
+
+        // 끝 표시를 넣고 소비자가 앞의 구간을 모두 처리할 때까지 대기
+        channel.push(Message{true, ChunkResult<R>{}});
+        {
+            std::unique_lock<std::mutex> lock(run_mutex);
+            run_finished.wait(lock, [this] { return finished; });
+        }
+
+        stats.producer_waits = channel.producer_wait_count() - producer_waits;
+        stats.consumer_waits = channel.consumer_wait_count() - consumer_waits;
+        auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+        if (!manager.writeRecord(handle, Severity::Info, "run chunks={} items={} producer_waits={} elapsed_us={} value={}",
+                                 stats.chunks, stats.items, stats.producer_waits, elapsed_us, total)) {
+            ++stats.failed_records;
+        }
+        stats.elapsed = std::chrono::steady_clock::now() - start_time;
+        previous_stats = stats;
+
+        if (producer_error) {
+            std::rethrow_exception(producer_error);
+        }
+        if (consumer_error) {
+            std::rethrow_exception(consumer_error);
+        }
+        return std::move(total);
+    }
+
+    // 마지막 run의 통계
+    const PipelineStats& last_stats() const {
+        return previous_stats;
+    }
+
+    // 채널에 들어 있는 구간 결과 수 (다른 스레드가 사용 중이면 근사값)
+    size_t channel_size() const {
+        return channel.size();
+    }
+};